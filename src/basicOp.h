@@ -8,25 +8,26 @@
 
 int sgn(const double x);
 
-double mad(const arma::vec& x);
+double medianSelect(double* x, const int n);
 
-arma::mat standardize(arma::mat X, const arma::rowvec& mx, const arma::vec& sx1, const int p);
+double quantileSelect(double* x, const int n, const double prob);
 
-arma::vec softThresh(const arma::vec& x, const arma::vec& Lambda, const int p);
+double quantileSelectR(double* x, const int n, const double prob);
 
-void lossQr(const arma::mat& Z, const arma::vec& Y, const arma::vec& beta, const double tau, const int i, arma::vec& dev, arma::vec& devsq);
+double mad(const arma::vec& x, arma::vec& work);
 
-arma::vec cmptLambdaLasso(const double lambda, const int p);
+double mad(const arma::vec& x);
 
-double lossL2(const arma::mat& Z, const arma::vec& Y, const arma::vec& beta, const double n1, const double tau);
+arma::mat standardize(arma::mat X, const arma::rowvec& mx, const arma::vec& sx1, const int p);
+
+// Maps coefficients fitted on the standardized design and the centered response back to the original scale, column by column
+void unstandardize(arma::mat& beta, const arma::rowvec& mx, const arma::vec& sx1, const double my, const int p);
 
-double updateL2(const arma::mat& Z, const arma::vec& Y, const arma::vec& beta, arma::vec& grad, const double n1, const double tau);
+void standardizeCoef(arma::mat& beta, const arma::rowvec& mx, const arma::vec& sx1, const double my, const int p);
 
-double lammL2(const arma::mat& Z, const arma::vec& Y, const arma::vec& Lambda, arma::vec& beta, const double tau, const double phi, const double gamma, 
-              const int p, const double n1);
+arma::vec softThresh(const arma::vec& x, const arma::vec& Lambda, const int p);
 
-arma::vec lasso(const arma::mat& Z, const arma::vec& Y, const double lambda, const double tau, const int p, const double n1, const double phi0 = 0.1, 
-                const double gamma = 1.2, const double epsilon = 0.01, const int iteMax = 500);
+arma::vec cmptLambdaLasso(const double lambda, const int p);
 
 arma::vec cmptLambdaSCAD(const arma::vec& beta, const double lambda, const int p, const double para = 3.7);
 
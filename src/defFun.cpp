@@ -1,5 +1,6 @@
 # include <RcppArmadillo.h>
 # include <cmath>
+# include <algorithm>
 # include "basicOp.h"
 // [[Rcpp::depends(RcppArmadillo)]]
 // [[Rcpp::plugins(cpp11)]]
@@ -9,107 +10,94 @@ int sgn(const double x) {
   return (x > 0) - (x < 0);
 }
 
-// [[Rcpp::export]]
-double mad(const arma::vec& x) {
-  return 1.482602 * arma::median(arma::abs(x - arma::median(x)));
+// Median by selection in O(n) on average, x is reordered
+double medianSelect(double* x, const int n) {
+  const int k = n / 2;
+  std::nth_element(x, x + k, x + n);
+  if (n % 2 == 1) {
+    return x[k];
+  }
+  const double lower = *std::max_element(x, x + k);
+  return lower + (x[k] - lower) / 2;
 }
 
-// [[Rcpp::export]]
-arma::mat standardize(arma::mat X, const arma::rowvec& mx, const arma::vec& sx1, const int p) {
-  for (int i = 0; i < p; i++) {
-    X.col(i) = (X.col(i) - mx(i)) * sx1(i);
+// Quantile by selection with the same interpolation as arma::quantile, x is reordered
+double quantileSelect(double* x, const int n, const double prob) {
+  const double pMin = 0.5 / n, pMax = (n - 0.5) / n;
+  if (prob <= pMin) {
+    return *std::min_element(x, x + n);
   }
-  return X;
+  if (prob >= pMax) {
+    return *std::max_element(x, x + n);
+  }
+  const int k = (int)std::floor(n * prob + 0.5);
+  std::nth_element(x, x + k - 1, x + n);
+  const double lower = x[k - 1];
+  const double upper = *std::min_element(x + k, x + n);
+  return lower + n * (prob - (k - 0.5) / n) * (upper - lower);
 }
 
-// [[Rcpp::export]]
-arma::vec softThresh(const arma::vec& x, const arma::vec& Lambda, const int p) {
-  return arma::sign(x) % arma::max(arma::abs(x) - Lambda, arma::zeros(p + 1));
+// Quantile by selection with the interpolation of R's default quantile (type 7), x is reordered
+double quantileSelectR(double* x, const int n, const double prob) {
+  const double h = (n - 1) * prob;
+  const int k = std::min(n - 1, std::max(0, (int)std::floor(h)));
+  std::nth_element(x, x + k, x + n);
+  const double lower = x[k];
+  if (k == n - 1) {
+    return lower;
+  }
+  const double upper = *std::min_element(x + k + 1, x + n);
+  return lower + (h - k) * (upper - lower);
 }
 
-// [[Rcpp::export]]
-void lossQr(const arma::mat& Z, const arma::vec& Y, const arma::vec& beta, const double tau, const int i, arma::vec& dev, arma::vec& devsq) {
-  arma::vec res = Y - Z * beta;
-  for (int k = 0; k < res.size(); k++) {
-    double temp =  res(k) >= 0 ? tau * res(k) : (tau - 1) * res(k);
-    dev(i) += temp;
-    devsq(i) += temp * temp;
+// Median absolute deviation with a caller-owned work vector, so repeated calls on the same length allocate nothing
+double mad(const arma::vec& x, arma::vec& work) {
+  const int n = x.n_elem;
+  work = x;
+  double* w = work.memptr();
+  const double med = medianSelect(w, n);
+  const double* px = x.memptr();
+  for (int i = 0; i < n; i++) {
+    w[i] = std::abs(px[i] - med);
   }
+  return 1.482602 * medianSelect(w, n);
 }
 
 // [[Rcpp::export]]
-arma::vec cmptLambdaLasso(const double lambda, const int p) {
-  arma::vec rst = lambda * arma::ones(p + 1);
-  rst(0) = 0;
-  return rst;
+double mad(const arma::vec& x) {
+  arma::vec work;
+  return mad(x, work);
 }
 
 // [[Rcpp::export]]
-double lossL2(const arma::mat& Z, const arma::vec& Y, const arma::vec& beta, const double n1, const double tau) {
-  arma::vec res = Y - Z * beta;
-  double rst = 0.0;
-  for (int i = 0; i < Y.size(); i++) {
-    rst += (res(i) > 0) ? (tau * res(i) * res(i)) : ((1 - tau) * res(i) * res(i));
+arma::mat standardize(arma::mat X, const arma::rowvec& mx, const arma::vec& sx1, const int p) {
+  for (int i = 0; i < p; i++) {
+    X.col(i) = (X.col(i) - mx(i)) * sx1(i);
   }
-  return 0.5 * n1 * rst;
+  return X;
 }
 
-// [[Rcpp::export]]
-double updateL2(const arma::mat& Z, const arma::vec& Y, const arma::vec& beta, arma::vec& grad, const double n1, const double tau) {
-  arma::vec res = Y - Z * beta;
-  double rst = 0.0;
-  grad = arma::zeros(grad.size());
-  for (int i = 0; i < Y.size(); i++) {
-    double temp = res(i) > 0 ? tau : (1 - tau);
-    grad -= temp * res(i) * Z.row(i).t();
-    rst += temp * res(i) * res(i);
-  }
-  grad *= n1;
-  return 0.5 * n1 * rst;
+void unstandardize(arma::mat& beta, const arma::rowvec& mx, const arma::vec& sx1, const double my, const int p) {
+  beta.rows(1, p).each_col() %= sx1;
+  beta.row(0) += my - mx * beta.rows(1, p);
+}
+
+// Inverse of unstandardize: coefficients on the scale of X and Y to the standardized design and centered response
+void standardizeCoef(arma::mat& beta, const arma::rowvec& mx, const arma::vec& sx1, const double my, const int p) {
+  beta.row(0) += mx * beta.rows(1, p) - my;
+  beta.rows(1, p).each_col() /= sx1;
 }
 
-// LAMM code for initialization
 // [[Rcpp::export]]
-double lammL2(const arma::mat& Z, const arma::vec& Y, const arma::vec& Lambda, arma::vec& beta, const double tau, const double phi, const double gamma, 
-              const int p, const double n1) {
-  double phiNew = phi;
-  arma::vec betaNew(p + 1);
-  arma::vec grad(p + 1);
-  double loss = updateL2(Z, Y, beta, grad, n1, tau);
-  while (true) {
-    arma::vec first = beta - grad / phiNew;
-    arma::vec second = Lambda / phiNew;
-    betaNew = softThresh(first, second, p);
-    double fVal = lossL2(Z, Y, betaNew, n1, tau);
-    arma::vec diff = betaNew - beta;
-    double psiVal = loss + arma::as_scalar(grad.t() * diff) + 0.5 * phiNew * arma::as_scalar(diff.t() * diff);
-    if (fVal <= psiVal) {
-      break;
-    }
-    phiNew *= gamma;
-  }
-  beta = betaNew;
-  return phiNew;
+arma::vec softThresh(const arma::vec& x, const arma::vec& Lambda, const int p) {
+  return arma::sign(x) % arma::max(arma::abs(x) - Lambda, arma::zeros(p + 1));
 }
 
 // [[Rcpp::export]]
-arma::vec lasso(const arma::mat& Z, const arma::vec& Y, const double lambda, const double tau, const int p, const double n1, const double phi0, 
-                const double gamma, const double epsilon, const int iteMax) {
-  arma::vec beta = arma::zeros(p + 1);
-  arma::vec betaNew = arma::zeros(p + 1);
-  arma::vec Lambda = cmptLambdaLasso(lambda, p);
-  double phi = phi0;
-  int ite = 0;
-  while (ite <= iteMax) {
-    ite++;
-    phi = lammL2(Z, Y, Lambda, betaNew, tau, phi, gamma, p, n1);
-    phi = std::max(phi0, phi / gamma);
-    if (arma::norm(betaNew - beta, "inf") <= epsilon) {
-      break;
-    }
-    beta = betaNew;
-  }
-  return betaNew;
+arma::vec cmptLambdaLasso(const double lambda, const int p) {
+  arma::vec rst = lambda * arma::ones(p + 1);
+  rst(0) = 0;
+  return rst;
 }
 
 // [[Rcpp::export]]
@@ -0,0 +1,240 @@
+#ifndef DESIGN_H
+#define DESIGN_H
+
+# include <RcppArmadillo.h>
+# include <cmath>
+# include <type_traits>
+# include "parallel.h"
+// [[Rcpp::depends(RcppArmadillo)]]
+// [[Rcpp::plugins(cpp11)]]
+
+// Standardized design with a leading intercept column, z_i = (1, (x_i - mx) * sx1), applied implicitly on a data matrix X that is neither
+// copied nor modified. With w = sx1 % v(1:p), Z * v = (v(0) - mx * w) + X * w, and Z^T u = (sum(u), sx1 % (X^T u - mx^T * sum(u))), so every
+// pass streams X once and the centering, scaling and intercept cost O(p) per pass.
+template <typename eT>
+struct StdDesign {
+  typedef eT elem_type;
+  const arma::Mat<eT>& X;
+  arma::rowvec mx;
+  arma::vec sx1;
+  arma::uword n_rows, n_cols;
+  // Means and Euclidean norms of the columns, the intercept included, for the gap-safe rule, empty unless they were computed for this design
+  arma::vec zbar, znorm;
+  StdDesign(const arma::Mat<eT>& _X, const arma::rowvec& _mx, const arma::vec& _sx1)
+    : X(_X), mx(_mx), sx1(_sx1), n_rows(_X.n_rows), n_cols(_X.n_cols + 1) {}
+  // The same standardization applied to another matrix with the same columns, e.g. the rows of a training fold
+  StdDesign<eT> with(const arma::Mat<eT>& _X) const {
+    return StdDesign<eT>(_X, mx, sx1);
+  }
+};
+
+// Access shared by an explicit design matrix and a standardized design: the stored matrix, the coefficients w on its columns and the
+// constant c such that Z * v = c + stored * w, and Z^T u from raw = stored^T u and s = sum(u).
+template <typename eT>
+const arma::Mat<eT>& stored(const arma::Mat<eT>& Z) {
+  return Z;
+}
+
+template <typename eT>
+const arma::Mat<eT>& stored(const StdDesign<eT>& Z) {
+  return Z.X;
+}
+
+template <typename eT>
+double fold(const arma::Mat<eT>& Z, const arma::vec& v, arma::vec& w) {
+  w = v;
+  return 0.0;
+}
+
+template <typename eT>
+double fold(const StdDesign<eT>& Z, const arma::vec& v, arma::vec& w) {
+  w = Z.sx1 % v.tail(Z.X.n_cols);
+  return v(0) - arma::dot(Z.mx, w);
+}
+
+template <typename eT>
+void unfold(const arma::Mat<eT>& Z, const arma::vec& raw, const double s, arma::vec& grad) {
+  grad = raw;
+}
+
+template <typename eT>
+void unfold(const StdDesign<eT>& Z, const arma::vec& raw, const double s, arma::vec& grad) {
+  const int p = Z.X.n_cols;
+  grad.set_size(p + 1);
+  grad(0) = s;
+  for (int j = 0; j < p; j++) {
+    grad(j + 1) = Z.sx1(j) * (raw(j) - Z.mx(j) * s);
+  }
+}
+
+// res -= Z * v. The slopes keep the zeros of v, so only the columns of X with a nonzero slope are read.
+template <typename eT>
+void matvecSub(const StdDesign<eT>& Z, const arma::vec& v, arma::vec& res) {
+  arma::vec w;
+  res -= fold(Z, v, w);
+  matvecSub(Z.X, w, res);
+}
+
+// res = Y - Z * beta
+template <typename eT>
+void residual(const StdDesign<eT>& Z, const arma::vec& Y, const arma::vec& beta, arma::vec& res) {
+  res = Y;
+  matvecSub(Z, beta, res);
+}
+
+// Sum of der over the row blocks
+inline double derSum(const arma::vec& der) {
+  const double* dr = der.memptr();
+  return blockSum(der.n_elem, [&](const int i0, const int i1) {
+    double rst = 0.0;
+    for (int i = i0; i < i1; i++) {
+      rst += dr[i];
+    }
+    return rst;
+  });
+}
+
+// grad = n1 * Z^T der
+template <typename eT>
+void gradient(const StdDesign<eT>& Z, const arma::vec& der, arma::vec& grad, const double n1) {
+  arma::vec raw;
+  gradient(Z.X, der, raw, 1.0);
+  unfold(Z, raw, derSum(der), grad);
+  grad *= n1;
+}
+
+// grad = n1 * Z^T der on the columns of Z listed in cols, column 0 being the intercept, and zero on the others
+template <typename eT>
+void gradient(const StdDesign<eT>& Z, const arma::vec& der, arma::vec& grad, const double n1, const arma::uvec& cols) {
+  const arma::uvec slopes = cols.elem(arma::find(cols > 0)) - 1;
+  arma::vec raw, full;
+  gradient(Z.X, der, raw, 1.0, slopes);
+  unfold(Z, raw, derSum(der), full);
+  grad.zeros(Z.n_cols);
+  grad.elem(cols) = n1 * full.elem(cols);
+}
+
+// Means and Euclidean norms of the columns of Z listed in cols, column 0 being the intercept, and zero on the others. The ones stored with Z
+// are returned as they are, otherwise the listed columns of X are read once.
+template <typename eT>
+void columnStats(const StdDesign<eT>& Z, const arma::uvec& cols, arma::vec& mean, arma::vec& norm) {
+  if (!Z.zbar.is_empty()) {
+    mean = Z.zbar;
+    norm = Z.znorm;
+    return;
+  }
+  const int n = Z.n_rows, nc = cols.n_elem;
+  mean.zeros(Z.n_cols);
+  norm.zeros(Z.n_cols);
+  const int nt = std::max(1, std::min(passThreads(n), nc));
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int k = 0; k < nc; k++) {
+    const int j = cols(k);
+    if (j == 0) {
+      mean(0) = 1.0;
+      norm(0) = std::sqrt((double)n);
+      continue;
+    }
+    const eT* xj = Z.X.colptr(j - 1);
+    const double mj = Z.mx(j - 1), sj = Z.sx1(j - 1);
+    double s = 0.0, ss = 0.0;
+    for (int i = 0; i < n; i++) {
+      const double z = (xj[i] - mj) * sj;
+      s += z;
+      ss += z * z;
+    }
+    mean(j) = s / n;
+    norm(j) = std::sqrt(ss);
+  }
+}
+
+// Stores the column means and norms in Z, one pass over X, e.g. once for the training rows of a fold
+template <typename eT>
+void storeStats(StdDesign<eT>& Z) {
+  arma::vec mean, norm;
+  columnStats(Z, arma::regspace<arma::uvec>(0, Z.n_cols - 1), mean, norm);
+  Z.zbar = mean;
+  Z.znorm = norm;
+}
+
+// Stores the column means and norms of a design standardized by the column means and standard deviations of its own rows, which are known
+// without a pass: the slopes have mean 0 and norm sqrt(n - 1)
+template <typename eT>
+void storeStdStats(StdDesign<eT>& Z) {
+  const int n = Z.n_rows;
+  Z.zbar.zeros(Z.n_cols);
+  Z.znorm.set_size(Z.n_cols);
+  Z.znorm.fill(std::sqrt(n - 1.0));
+  Z.zbar(0) = 1.0;
+  Z.znorm(0) = std::sqrt((double)n);
+}
+
+// H.slice(k) = Z^T diag(Q.col(k)) Z for the weight columns of Q, all entries >= 0, in one pass over X. Each thread standardizes a row panel of
+// its block once into a small buffer, so the centering costs no precision, and for every weight column adds the crossproduct of the panel
+// scaled by sqrt(q), which Armadillo computes as a symmetric rank-k update. The per-thread partial sums are added up in thread order.
+template <typename eT>
+void weightedGram(const StdDesign<eT>& Z, const arma::mat& Q, arma::cube& H) {
+  const int n = Z.n_rows, p = Z.X.n_cols, K = Q.n_cols;
+  const int rows = std::max(64, 32768 / (p + 1));
+  const int nt = passThreads(n);
+  std::vector<arma::cube> part(nt);
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int t = 0; t < nt; t++) {
+    const int b1 = blockBegin(n, t + 1, nt);
+    arma::cube& Ht = part[t];
+    Ht.zeros(p + 1, p + 1, K);
+    arma::mat A, As;
+    for (int i0 = blockBegin(n, t, nt); i0 < b1; i0 += rows) {
+      const int m = std::min(b1, i0 + rows) - i0;
+      A.set_size(m, p + 1);
+      A.col(0).ones();
+      for (int j = 0; j < p; j++) {
+        const eT* xj = Z.X.colptr(j) + i0;
+        double* aj = A.colptr(j + 1);
+        const double mj = Z.mx(j), sj = Z.sx1(j);
+        for (int i = 0; i < m; i++) {
+          aj[i] = (xj[i] - mj) * sj;
+        }
+      }
+      for (int k = 0; k < K; k++) {
+        As = A.each_col() % arma::sqrt(Q(arma::span(i0, i0 + m - 1), arma::span(k)));
+        Ht.slice(k) += As.t() * As;
+      }
+    }
+  }
+  H = part[0];
+  for (int t = 1; t < nt; t++) {
+    H += part[t];
+  }
+}
+
+// H = Z^T diag(q) Z for weights q >= 0
+template <typename eT>
+void weightedGram(const StdDesign<eT>& Z, const arma::vec& q, arma::mat& H) {
+  const arma::mat Q(const_cast<double*>(q.memptr()), q.n_elem, 1, false, true);
+  arma::cube Hq;
+  weightedGram(Z, Q, Hq);
+  H = Hq.slice(0);
+}
+
+// Standardized design of the caller's X. In double precision X is used in place. In single precision X is standardized once into store,
+// which halves the memory of a double copy and keeps the float values centered, so no precision is lost to cancellation.
+template <typename eT>
+StdDesign<eT> stdDesign(const arma::mat& X, const arma::rowvec& mx, const arma::vec& sx1, arma::Mat<eT>& store) {
+  if constexpr (std::is_same<eT, double>::value) {
+    return StdDesign<eT>(X, mx, sx1);
+  } else {
+    const int n = X.n_rows, p = X.n_cols;
+    store.set_size(n, p);
+    for (int j = 0; j < p; j++) {
+      const double* xj = X.colptr(j);
+      eT* sj = store.colptr(j);
+      for (int i = 0; i < n; i++) {
+        sj[i] = (eT)((xj[i] - mx(j)) * sx1(j));
+      }
+    }
+    return StdDesign<eT>(store, arma::zeros<arma::rowvec>(p), arma::ones(p));
+  }
+}
+
+#endif
@@ -0,0 +1,723 @@
+#ifndef HIGHD_H
+#define HIGHD_H
+
+# include <RcppArmadillo.h>
+# include <cmath>
+# include <utility>
+# include "basicOp.h"
+# include "kernel.h"
+# include "design.h"
+// [[Rcpp::depends(RcppArmadillo)]]
+// [[Rcpp::plugins(cpp11)]]
+
+// High-dimensional conquer engine shared by the five kernels. Every solver is templated on the kernel (its loss() method), on the penalty
+// (a proximal map) and on the storage of the design Z, which is arma::mat or, in the single precision mode, arma::fmat. Residuals, gradients
+// and coefficients are always double.
+
+// Mean smoothed loss at the residuals res, the derivatives are written into der unless it is null
+template <typename Kernel>
+double meanLoss(const arma::vec& res, double* der, const Kernel& ker) {
+  const double* r = res.memptr();
+  return blockSum(res.n_elem, [&](const int i0, const int i1) {
+    return ker.loss(r + i0, der == NULL ? NULL : der + i0, i1 - i0);
+  }) / res.n_elem;
+}
+
+// Iterate of the LAMM solver: the coefficients, the residuals Y - Z * beta, the derivatives of the loss at them and the mean loss
+struct LammIterate {
+  arma::vec beta, res, der;
+  double loss;
+};
+
+// Proximal maps of the penalties: the minimizer over b of <grad, b - beta> + phi / 2 * ||b - beta||^2 + penalty(b). screen(grad, c, keep) marks
+// in keep the penalized coordinates j >= 1 whose gradient exceeds c times the level at which a zero coordinate, or a zero group, stays at zero,
+// so c = 1 marks the violations of the KKT conditions at a solution with those coordinates at zero. The convex coordinate-wise penalties have
+// gapSafe set and provide what the gap-safe rule needs: the penalty at beta, the level of |z_j^T theta| below which a zero coordinate is
+// certified, the largest dual scale s <= scale that keeps s * u feasible on the columns cols, and the conjugate of the penalty there.
+struct LassoProx {
+  static const bool gapSafe = true;
+  const arma::vec& Lambda;
+  int p;
+  LassoProx(const arma::vec& _Lambda, const int _p) : Lambda(_Lambda), p(_p) {}
+  arma::vec operator()(const arma::vec& beta, const arma::vec& grad, const double phi) const {
+    return softThresh(beta - grad / phi, Lambda / phi, p);
+  }
+  void screen(const arma::vec& grad, const double c, arma::uvec& keep) const {
+    keep.zeros(p + 1);
+    for (int j = 1; j <= p; j++) {
+      keep(j) = std::abs(grad(j)) > c * Lambda(j);
+    }
+  }
+  double penalty(const arma::vec& beta) const {
+    return arma::dot(Lambda, arma::abs(beta));
+  }
+  double level(const int j) const {
+    return Lambda(j);
+  }
+  double dualScale(const arma::vec& u, const arma::uvec& cols, double scale) const {
+    for (arma::uword k = 0; k < cols.n_elem; k++) {
+      const int j = cols(k);
+      if (j > 0 && scale * std::abs(u(j)) > Lambda(j)) {
+        scale = Lambda(j) / std::abs(u(j));
+      }
+    }
+    return scale;
+  }
+  double conjugate(const arma::vec& u, const arma::uvec& cols) const {
+    return 0.0;
+  }
+};
+
+struct ElasticProx {
+  static const bool gapSafe = true;
+  const arma::vec& Lambda;
+  double alpha;
+  int p;
+  ElasticProx(const arma::vec& _Lambda, const double _alpha, const int _p) : Lambda(_Lambda), alpha(_alpha), p(_p) {}
+  arma::vec operator()(const arma::vec& beta, const arma::vec& grad, const double phi) const {
+    return softThresh(beta - grad / phi, alpha * Lambda / phi, p) / (1.0 + (2.0 - 2 * alpha) * Lambda / phi);
+  }
+  void screen(const arma::vec& grad, const double c, arma::uvec& keep) const {
+    keep.zeros(p + 1);
+    for (int j = 1; j <= p; j++) {
+      keep(j) = std::abs(grad(j)) > c * alpha * Lambda(j);
+    }
+  }
+  double penalty(const arma::vec& beta) const {
+    return arma::dot(Lambda, alpha * arma::abs(beta) + (1.0 - alpha) * arma::square(beta));
+  }
+  double level(const int j) const {
+    return alpha * Lambda(j);
+  }
+  // The ridge part makes every dual point feasible, except for the pure lasso alpha = 1
+  double dualScale(const arma::vec& u, const arma::uvec& cols, double scale) const {
+    if (alpha < 1.0) {
+      return scale;
+    }
+    return LassoProx(Lambda, p).dualScale(u, cols, scale);
+  }
+  double conjugate(const arma::vec& u, const arma::uvec& cols) const {
+    if (alpha >= 1.0) {
+      return 0.0;
+    }
+    double rst = 0.0;
+    for (arma::uword k = 0; k < cols.n_elem; k++) {
+      const int j = cols(k);
+      const double excess = std::abs(u(j)) - alpha * Lambda(j);
+      if (j > 0 && excess > 0) {
+        rst += excess * excess / (4.0 * (1.0 - alpha) * Lambda(j));
+      }
+    }
+    return rst;
+  }
+};
+
+struct GroupProx {
+  static const bool gapSafe = false;
+  double lambda;
+  const arma::vec& group;
+  const arma::vec& weight;
+  int p, G;
+  GroupProx(const double _lambda, const arma::vec& _group, const arma::vec& _weight, const int _p, const int _G)
+    : lambda(_lambda), group(_group), weight(_weight), p(_p), G(_G) {}
+  // Shrinks each group of betaNew towards zero
+  void shrink(arma::vec& betaNew, const double phi) const {
+    arma::vec subNorm = arma::zeros(G);
+    for (int i = 1; i <= p; i++) {
+      subNorm(group(i)) += betaNew(i) * betaNew(i);
+    }
+    subNorm = arma::max(1.0 - lambda * weight / (phi * arma::sqrt(subNorm)), arma::zeros(G));
+    for (int i = 1; i <= p; i++) {
+      betaNew(i) *= subNorm(group(i));
+    }
+  }
+  arma::vec operator()(const arma::vec& beta, const arma::vec& grad, const double phi) const {
+    arma::vec betaNew = beta - grad / phi;
+    shrink(betaNew, phi);
+    return betaNew;
+  }
+  // Keeps the groups of the coordinates j >= 1 whose part u of the gradient has ||u|| > c * lambda * weight
+  void screenGroups(const arma::vec& u, const double c, arma::uvec& keep) const {
+    arma::vec subNorm = arma::zeros(G);
+    for (int i = 1; i <= p; i++) {
+      subNorm(group(i)) += u(i) * u(i);
+    }
+    arma::uvec keepGroup = arma::sqrt(subNorm) > c * lambda * weight;
+    keep.zeros(p + 1);
+    for (int i = 1; i <= p; i++) {
+      keep(i) = keepGroup(group(i));
+    }
+  }
+  void screen(const arma::vec& grad, const double c, arma::uvec& keep) const {
+    screenGroups(grad, c, keep);
+  }
+};
+
+struct SparseGroupProx {
+  static const bool gapSafe = false;
+  LassoProx l1;
+  GroupProx l2;
+  SparseGroupProx(const arma::vec& Lambda, const double lambda, const arma::vec& group, const arma::vec& weight, const int p, const int G)
+    : l1(Lambda, p), l2(lambda, group, weight, p, G) {}
+  arma::vec operator()(const arma::vec& beta, const arma::vec& grad, const double phi) const {
+    arma::vec betaNew = l1(beta, grad, phi);
+    l2.shrink(betaNew, phi);
+    return betaNew;
+  }
+  // A group stays at zero when the gradient soft-thresholded by the l1 levels is within the group level
+  void screen(const arma::vec& grad, const double c, arma::uvec& keep) const {
+    l2.screenGroups(softThresh(grad, c * l1.Lambda, l1.p), c, keep);
+  }
+};
+
+// Constants of the dynamic gap-safe screening of a convex penalized fit: the bound on hess() of the kernel, the quantile level and the number of
+// LAMM iterations between two screenings
+struct SafeRule {
+  double lipschitz, tau;
+  int every;
+  template <typename Kernel>
+  SafeRule(const Kernel& ker, const int _every = 10) : lipschitz(ker.hessMax()), tau(ker.tau), every(_every) {}
+};
+
+// Dynamic gap-safe screening (Ndiaye et al., 2017, JMLR) at the iterate cur, with grad = n1 * Z^T der on the columns cols. Columns are dropped
+// from cols when their coordinate is zero in cur and certified to be zero at the optimum, and never come back. The dual point is the scaled
+// negative gradient in the fitted values theta = -s * (der - mean(der)) / n, so Z^T theta = -s * u with u = grad - mean(der) * zbar: centering
+// satisfies the constraint of the intercept, and s is capped so that every theta_i * n stays in [tau - 1, tau], the domain of the conjugate of
+// the loss, and, for the lasso, so that |z_j^T theta| <= lambda_j. The smoothed loss lies above the check loss, which bounds its conjugate by
+// y_i * t, and Fenchel-Young gives it exactly at der_i, so by convexity the dual objective at theta is bounded below without evaluating any
+// conjugate. The conjugate of the loss is n / lipschitz strongly convex, so the dual optimum lies in the ball of radius
+// sqrt(2 * lipschitz * gap / n) around theta, and coordinate j is certified when |z_j^T theta| + ||z_j|| * radius < level_j.
+template <typename Prox>
+void gapScreen(const Prox& prox, const SafeRule& rule, const LammIterate& cur, const arma::vec& Y, const double ySum, const arma::vec& grad,
+               const arma::vec& zbar, const arma::vec& znorm, arma::uvec& cols) {
+  const int n = cur.res.n_elem;
+  const double m = arma::mean(cur.der), tau = rule.tau;
+  double scale = m > 0 ? tau / (tau + m) : (1.0 - tau) / (1.0 - tau - m);
+  const arma::vec u = grad - m * zbar;
+  scale = prox.dualScale(u, cols, scale);
+  const double fitted = arma::dot(cur.der, Y) - arma::dot(cur.der, cur.res);
+  const double dual = -scale / n * (fitted - n * cur.loss - m * ySum) - prox.conjugate(scale * u, cols);
+  const double gap = std::max(cur.loss + prox.penalty(cur.beta) - dual, 0.0);
+  const double radius = std::sqrt(2.0 * rule.lipschitz * gap / n);
+  arma::uvec keep(cols.n_elem);
+  int nk = 0;
+  for (arma::uword k = 0; k < cols.n_elem; k++) {
+    const int j = cols(k);
+    if (j == 0 || cur.beta(j) != 0 || scale * std::abs(u(j)) + znorm(j) * radius >= prox.level(j)) {
+      keep(nk++) = j;
+    }
+  }
+  cols = keep.head(nk);
+}
+
+// One LAMM step from cur with the gradient grad at cur.beta: phi is inflated by gamma until the local quadratic majorizes the loss at the
+// proximal update. A trial moves the residuals of cur by Z * (betaNew - beta), which only reads the columns whose coefficient changed, and
+// evaluates the loss and its derivatives there.
+// The accepted trial is swapped into cur, so its residuals, loss and derivatives start the next step, and trial is left with the previous iterate.
+template <typename Kernel, typename Prox, typename Design>
+double lammHd(const Design& Z, const Prox& prox, LammIterate& cur, LammIterate& trial, const arma::vec& grad, const Kernel& ker,
+              const double phi, const double gamma) {
+  double phiNew = phi;
+  arma::vec diff;
+  while (true) {
+    trial.beta = prox(cur.beta, grad, phiNew);
+    diff = trial.beta - cur.beta;
+    trial.res = cur.res;
+    matvecSub(Z, diff, trial.res);
+    trial.loss = meanLoss(trial.res, trial.der.memptr(), ker);
+    double psiVal = cur.loss + arma::dot(grad, diff) + 0.5 * phiNew * arma::dot(diff, diff);
+    if (trial.loss <= psiVal) {
+      break;
+    }
+    phiNew *= gamma;
+  }
+  std::swap(cur, trial);
+  return phiNew;
+}
+
+// LAMM iterations from beta until the coefficients move by less than epsilon in sup norm, the number of iterations is returned. The
+// residuals are formed once from Y and then carried from step to step, so the gradient is the only full pass over Z in an iteration and each
+// trial costs O(n) per coefficient it changes. If cols is given, the gradient is only formed on those columns and is zero on the others, so
+// the coordinates outside cols, which must be zero in beta, stay at zero. If safe is given and the penalty is convex coordinate-wise, the
+// gap-safe rule runs every safe->every iterations and the gradient is only formed on the columns it has not eliminated.
+template <typename Kernel, typename Prox, typename Design>
+int lammSolve(const Design& Z, const arma::vec& Y, const Prox& prox, arma::vec& betaNew, const Kernel& ker, const int p, const double n1,
+              const double phi0, const double gamma, const double epsilon, const int iteMax, const arma::uvec* cols = NULL,
+              const SafeRule* safe = NULL) {
+  LammIterate cur, trial;
+  cur.beta = betaNew;
+  residual(Z, Y, cur.beta, cur.res);
+  cur.der.set_size(cur.res.n_elem);
+  trial.der.set_size(cur.res.n_elem);
+  cur.loss = meanLoss(cur.res, cur.der.memptr(), ker);
+  arma::vec grad(p + 1);
+  const bool screening = Prox::gapSafe && safe != NULL;
+  arma::uvec active;
+  arma::vec zbar, znorm;
+  double ySum = 0.0;
+  if (screening) {
+    active = cols == NULL ? arma::regspace<arma::uvec>(0, p) : *cols;
+    columnStats(Z, active, zbar, znorm);
+    ySum = arma::accu(Y);
+  }
+  double phi = phi0;
+  int ite = 0;
+  while (ite <= iteMax) {
+    ite++;
+    if (screening) {
+      gradient(Z, cur.der, grad, n1, active);
+      if constexpr (Prox::gapSafe) {
+        if ((ite - 1) % safe->every == 0) {
+          gapScreen(prox, *safe, cur, Y, ySum, grad, zbar, znorm, active);
+        }
+      }
+    } else if (cols == NULL) {
+      gradient(Z, cur.der, grad, n1);
+    } else {
+      gradient(Z, cur.der, grad, n1, *cols);
+    }
+    phi = lammHd(Z, prox, cur, trial, grad, ker, phi, gamma);
+    phi = std::max(phi0, phi / gamma);
+    if (arma::norm(cur.beta - trial.beta, "inf") <= epsilon) {
+      break;
+    }
+  }
+  betaNew = cur.beta;
+  return ite;
+}
+
+// Mean smoothed loss derivatives at beta and the full gradient n1 * Z^T der
+template <typename Kernel, typename Design>
+void fullGradient(const Design& Z, const arma::vec& Y, const arma::vec& beta, const Kernel& ker, const double n1, arma::vec& grad) {
+  arma::vec res;
+  residual(Z, Y, beta, res);
+  arma::vec der(res.n_elem);
+  meanLoss(res, der.memptr(), ker);
+  gradient(Z, der, grad, n1);
+}
+
+// Sequential strong rule (Tibshirani et al., 2012, JRSSB) for a fit warm-started at the solution beta of the previous lambda on a path, with
+// c = 2 - lambdaPrev / lambda. The working set is the intercept, the support of beta and the coordinates, or groups, that prox.screen marks at
+// scale c, and LAMM only forms the gradient on it. The KKT conditions are then checked with the full gradient at the fit, the violators join
+// the working set and the fit is repeated from where it stopped, so the result is that of the unrestricted solver up to its tolerance.
+template <typename Kernel, typename Prox, typename Design>
+int screenSolve(const Design& Z, const arma::vec& Y, const Prox& prox, arma::vec& beta, const Kernel& ker, const int p, const double n1,
+                const double c, const double phi0, const double gamma, const double epsilon, const int iteMax,
+                const SafeRule* safe = NULL) {
+  arma::vec grad;
+  arma::uvec keep, viol;
+  fullGradient(Z, Y, beta, ker, n1, grad);
+  prox.screen(grad, c, keep);
+  keep(0) = 1;
+  keep.elem(arma::find(beta)).ones();
+  int ite = 0;
+  while (true) {
+    const arma::uvec cols = arma::find(keep);
+    ite += lammSolve(Z, Y, prox, beta, ker, p, n1, phi0, gamma, epsilon, iteMax, &cols, safe);
+    if ((int)cols.n_elem == p + 1) {
+      break;
+    }
+    fullGradient(Z, Y, beta, ker, n1, grad);
+    prox.screen(grad, 1.0, viol);
+    const arma::uvec add = arma::find(viol > keep);
+    if (add.is_empty()) {
+      break;
+    }
+    keep.elem(add).ones();
+  }
+  return ite;
+}
+
+// Asymmetric L2 lasso from zero, the initial value of the penalized fits
+template <typename Design>
+arma::vec lassoL2(const Design& Z, const arma::vec& Y, const double lambda, const double tau, const int p, const double n1,
+                  const double phi0, const double gamma, const double epsilon, const int iteMax) {
+  arma::vec beta = arma::zeros(p + 1);
+  arma::vec Lambda = cmptLambdaLasso(lambda, p);
+  lammSolve(Z, Y, LassoProx(Lambda, p), beta, L2Kernel(tau), p, n1, phi0, gamma, epsilon, iteMax);
+  return beta;
+}
+
+// L2 lasso initialization with the intercept reset to the tau-quantile of the partial residuals
+template <typename Design>
+arma::vec lassoStart(const Design& Z, const arma::vec& Y, const double lambda, const double tau, const int p, const double n1,
+                     const double phi0, const double gamma, const double epsilon, const int iteMax) {
+  arma::vec beta = lassoL2(Z, Y, lambda, tau, p, n1, phi0, gamma, epsilon, iteMax);
+  arma::vec res;
+  beta(0) = 0.0;
+  residual(Z, Y, beta, res);
+  beta(0) = quantileSelect(res.memptr(), res.n_elem, tau);
+  return beta;
+}
+
+// Sums of the check loss and of its square over a test fold, accumulated into entry i of dev and devsq
+template <typename Design>
+void checkLoss(const Design& Z, const arma::vec& Y, const arma::vec& beta, const double tau, const int i, arma::vec& dev, arma::vec& devsq) {
+  arma::vec res;
+  residual(Z, Y, beta, res);
+  for (int k = 0; k < res.size(); k++) {
+    double temp =  res(k) >= 0 ? tau * res(k) : (tau - 1) * res(k);
+    dev(i) += temp;
+    devsq(i) += temp * temp;
+  }
+}
+
+// Solvers of one penalty with a given kernel. cold() fits one lambda from the L2 lasso initialization, warm() from betaWarm along a path, where
+// lambdaPrev > 0 is the lambda that betaWarm solves and turns on the sequential strong rule. The lasso and the elastic net also run the
+// gap-safe rule, which only removes coordinates that are provably zero.
+template <typename Kernel>
+struct LammSolver {
+  Kernel ker;
+  int p;
+  double phi0, gamma, epsilon;
+  int iteMax;
+  LammSolver(const Kernel& _ker, const int _p, const double _phi0, const double _gamma, const double _epsilon, const int _iteMax)
+    : ker(_ker), p(_p), phi0(_phi0), gamma(_gamma), epsilon(_epsilon), iteMax(_iteMax) {}
+  template <typename Design>
+  arma::vec start(const Design& Z, const arma::vec& Y, const double lambda, const double n1) const {
+    return lassoStart(Z, Y, lambda, ker.tau, p, n1, phi0, gamma, epsilon, iteMax);
+  }
+  // Smallest lambda at which the fit with the gradient grad at its zero slopes solves the penalized problem
+  double lambdaMax(const arma::vec& grad) const {
+    return arma::max(arma::abs(grad.tail(p)));
+  }
+  // Whether the intercept-only fit solves the problem at lambdaMax, so a decreasing path can start from it
+  bool nullStart() const {
+    return true;
+  }
+  template <typename Design, typename Prox>
+  void solve(const Design& Z, const arma::vec& Y, const Prox& prox, arma::vec& beta, const double n1, const double lambda,
+             const double lambdaPrev, const SafeRule* safe = NULL) const {
+    if (lambdaPrev > 0) {
+      screenSolve(Z, Y, prox, beta, ker, p, n1, 2.0 - lambdaPrev / lambda, phi0, gamma, epsilon, iteMax, safe);
+    } else {
+      lammSolve(Z, Y, prox, beta, ker, p, n1, phi0, gamma, epsilon, iteMax, NULL, safe);
+    }
+  }
+};
+
+template <typename Kernel>
+struct LassoSolver : LammSolver<Kernel> {
+  using LammSolver<Kernel>::LammSolver;
+  template <typename Design>
+  arma::vec warm(const Design& Z, const arma::vec& Y, const double lambda, const arma::vec& betaWarm, const double n1,
+                 const double lambdaPrev = 0.0) const {
+    arma::vec beta = betaWarm;
+    arma::vec Lambda = cmptLambdaLasso(lambda, this->p);
+    SafeRule safe(this->ker);
+    this->solve(Z, Y, LassoProx(Lambda, this->p), beta, n1, lambda, lambdaPrev, &safe);
+    return beta;
+  }
+  template <typename Design>
+  arma::vec cold(const Design& Z, const arma::vec& Y, const double lambda, const double n1) const {
+    return warm(Z, Y, lambda, this->start(Z, Y, lambda, n1), n1);
+  }
+};
+
+template <typename Kernel>
+struct ElasticSolver : LammSolver<Kernel> {
+  double alpha;
+  ElasticSolver(const Kernel& _ker, const double _alpha, const int _p, const double _phi0, const double _gamma, const double _epsilon,
+                const int _iteMax) : LammSolver<Kernel>(_ker, _p, _phi0, _gamma, _epsilon, _iteMax), alpha(_alpha) {}
+  double lambdaMax(const arma::vec& grad) const {
+    return arma::max(arma::abs(grad.tail(this->p))) / alpha;
+  }
+  // The ridge alpha = 0 has no lambdaMax, no lambda makes the zero slopes optimal
+  bool nullStart() const {
+    return alpha > 0;
+  }
+  template <typename Design>
+  arma::vec warm(const Design& Z, const arma::vec& Y, const double lambda, const arma::vec& betaWarm, const double n1,
+                 const double lambdaPrev = 0.0) const {
+    arma::vec beta = betaWarm;
+    arma::vec Lambda = cmptLambdaLasso(lambda, this->p);
+    SafeRule safe(this->ker);
+    this->solve(Z, Y, ElasticProx(Lambda, alpha, this->p), beta, n1, lambda, lambdaPrev, &safe);
+    return beta;
+  }
+  template <typename Design>
+  arma::vec cold(const Design& Z, const arma::vec& Y, const double lambda, const double n1) const {
+    return warm(Z, Y, lambda, this->start(Z, Y, lambda, n1), n1);
+  }
+};
+
+template <typename Kernel>
+struct GroupSolver : LammSolver<Kernel> {
+  const arma::vec& group;
+  const arma::vec& weight;
+  int G;
+  GroupSolver(const Kernel& _ker, const arma::vec& _group, const arma::vec& _weight, const int _G, const int _p, const double _phi0,
+              const double _gamma, const double _epsilon, const int _iteMax)
+    : LammSolver<Kernel>(_ker, _p, _phi0, _gamma, _epsilon, _iteMax), group(_group), weight(_weight), G(_G) {}
+  double lambdaMax(const arma::vec& grad) const {
+    arma::vec subNorm = arma::zeros(G);
+    for (int i = 1; i <= this->p; i++) {
+      subNorm(group(i)) += grad(i) * grad(i);
+    }
+    return arma::max(arma::sqrt(subNorm) / weight);
+  }
+  template <typename Design>
+  arma::vec warm(const Design& Z, const arma::vec& Y, const double lambda, const arma::vec& betaWarm, const double n1,
+                 const double lambdaPrev = 0.0) const {
+    arma::vec beta = betaWarm;
+    this->solve(Z, Y, GroupProx(lambda, group, weight, this->p, G), beta, n1, lambda, lambdaPrev);
+    return beta;
+  }
+  template <typename Design>
+  arma::vec cold(const Design& Z, const arma::vec& Y, const double lambda, const double n1) const {
+    return warm(Z, Y, lambda, this->start(Z, Y, lambda, n1), n1);
+  }
+};
+
+template <typename Kernel>
+struct SparseGroupSolver : GroupSolver<Kernel> {
+  using GroupSolver<Kernel>::GroupSolver;
+  // A group is at zero when ||S(grad_g, lambda)|| <= lambda * weight_g, the smallest such lambda of each group is found by bisection
+  double lambdaMax(const arma::vec& grad) const {
+    const int G = this->G;
+    arma::vec lo = arma::zeros(G), hi = arma::zeros(G);
+    for (int i = 1; i <= this->p; i++) {
+      hi(this->group(i)) = std::max(hi(this->group(i)), std::abs(grad(i)));
+    }
+    for (int it = 0; it < 60; it++) {
+      arma::vec mid = 0.5 * (lo + hi), subNorm = arma::zeros(G);
+      for (int i = 1; i <= this->p; i++) {
+        const double excess = std::max(std::abs(grad(i)) - mid(this->group(i)), 0.0);
+        subNorm(this->group(i)) += excess * excess;
+      }
+      for (int g = 0; g < G; g++) {
+        if (std::sqrt(subNorm(g)) > mid(g) * this->weight(g)) {
+          lo(g) = mid(g);
+        } else {
+          hi(g) = mid(g);
+        }
+      }
+    }
+    return arma::max(hi);
+  }
+  template <typename Design>
+  arma::vec warm(const Design& Z, const arma::vec& Y, const double lambda, const arma::vec& betaWarm, const double n1,
+                 const double lambdaPrev = 0.0) const {
+    arma::vec beta = betaWarm;
+    arma::vec Lambda = cmptLambdaLasso(lambda, this->p);
+    this->solve(Z, Y, SparseGroupProx(Lambda, lambda, this->group, this->weight, this->p, this->G), beta, n1, lambda, lambdaPrev);
+    return beta;
+  }
+  template <typename Design>
+  arma::vec cold(const Design& Z, const arma::vec& Y, const double lambda, const double n1) const {
+    return warm(Z, Y, lambda, this->start(Z, Y, lambda, n1), n1);
+  }
+};
+
+// Weights of the iteratively reweighted l1 penalty for scad and mcp
+struct ScadWeight {
+  double para;
+  ScadWeight(const double _para) : para(_para) {}
+  arma::vec operator()(const arma::vec& beta, const double lambda, const int p) const {
+    return cmptLambdaSCAD(beta, lambda, p, para);
+  }
+};
+
+struct McpWeight {
+  double para;
+  McpWeight(const double _para) : para(_para) {}
+  arma::vec operator()(const arma::vec& beta, const double lambda, const int p) const {
+    return cmptLambdaMCP(beta, lambda, p, para);
+  }
+};
+
+// Concave penalties: a contraction stage with the weights at the initial value, followed on a cold start by up to iteTight tightening stages
+// that recompute the weights at the current solution. Warm starts along a path only run the contraction stage.
+template <typename Kernel, typename Weight>
+struct ConcaveSolver : LammSolver<Kernel> {
+  Weight cmptLambda;
+  int iteTight;
+  ConcaveSolver(const Kernel& _ker, const Weight& _cmptLambda, const int _iteTight, const int _p, const double _phi0, const double _gamma,
+                const double _epsilon, const int _iteMax)
+    : LammSolver<Kernel>(_ker, _p, _phi0, _gamma, _epsilon, _iteMax), cmptLambda(_cmptLambda), iteTight(_iteTight) {}
+  template <typename Design>
+  void stage(const Design& Z, const arma::vec& Y, const double lambda, arma::vec& beta, const double n1, const double lambdaPrev = 0.0) const {
+    arma::vec Lambda = cmptLambda(beta, lambda, this->p);
+    this->solve(Z, Y, LassoProx(Lambda, this->p), beta, n1, lambda, lambdaPrev);
+  }
+  template <typename Design>
+  arma::vec warm(const Design& Z, const arma::vec& Y, const double lambda, const arma::vec& betaWarm, const double n1,
+                 const double lambdaPrev = 0.0) const {
+    arma::vec beta = betaWarm;
+    stage(Z, Y, lambda, beta, n1, lambdaPrev);
+    return beta;
+  }
+  template <typename Design>
+  arma::vec cold(const Design& Z, const arma::vec& Y, const double lambda, const double n1) const {
+    arma::vec beta = warm(Z, Y, lambda, this->start(Z, Y, lambda, n1), n1);
+    int iteT = 1;
+    while (iteT <= iteTight) {
+      iteT++;
+      arma::vec beta0 = beta;
+      stage(Z, Y, lambda, beta, n1);
+      if (arma::norm(beta - beta0, "inf") <= this->epsilon) {
+        break;
+      }
+    }
+    return beta;
+  }
+};
+
+// Intercept-only fit, which solves the penalized problem for every lambda at or above solver.lambdaMax(grad), with grad the full gradient there.
+// LAMM runs on the intercept alone from the tau-quantile of Y.
+template <typename Design, typename Solver>
+arma::vec nullFit(const Design& Z, const arma::vec& Y, const Solver& solver, const double n1, arma::vec& grad) {
+  const int p = solver.p;
+  arma::vec beta = arma::zeros(p + 1);
+  arma::vec work = Y;
+  beta(0) = quantileSelect(work.memptr(), work.n_elem, solver.ker.tau);
+  const arma::vec Lambda = arma::zeros(p + 1);
+  const arma::uvec cols = arma::zeros<arma::uvec>(1);
+  lammSolve(Z, Y, LassoProx(Lambda, p), beta, solver.ker, p, n1, solver.phi0, solver.gamma, solver.epsilon, solver.iteMax, &cols);
+  fullGradient(Z, Y, beta, solver.ker, n1, grad);
+  return beta;
+}
+
+// Path in decreasing order of lambda from the intercept-only fit at lambdaMax, each lambda below it warm-started from the previous fit and screened
+// with the previous lambda, so the sparsest and cheapest fits come first and no L2 lasso initialization is needed. visit(i, beta) receives the
+// fit of lambdaSeq(i), so the caller keeps the order of lambdaSeq. Without a null start, the path starts from the L2 lasso fit at the largest
+// lambda and runs without the strong rule.
+template <typename Design, typename Solver, typename Visit>
+void descendPath(const Design& Z, const arma::vec& Y, const arma::vec& lambdaSeq, const Solver& solver, const double n1, const Visit& visit) {
+  const arma::uvec order = arma::sort_index(lambdaSeq, "descend");
+  const bool strong = solver.nullStart();
+  arma::vec beta;
+  double lambdaPrev = arma::datum::inf;
+  if (strong) {
+    arma::vec grad;
+    beta = nullFit(Z, Y, solver, n1, grad);
+    lambdaPrev = solver.lambdaMax(grad);
+  } else {
+    beta = solver.start(Z, Y, lambdaSeq(order(0)), n1);
+  }
+  for (arma::uword k = 0; k < order.n_elem; k++) {
+    const int i = order(k);
+    if (lambdaSeq(i) < lambdaPrev) {
+      beta = solver.warm(Z, Y, lambdaSeq(i), beta, n1, strong ? lambdaPrev : 0.0);
+      lambdaPrev = lambdaSeq(i);
+    }
+    visit(i, beta);
+  }
+}
+
+// Entry points: X is standardized implicitly, stored as eT, and the response is centered, the coefficients are mapped back to the original scale
+template <typename eT, typename Solver>
+arma::vec conquerHd(const arma::mat& X, arma::vec Y, const double lambda, const Solver& solver) {
+  const int n = X.n_rows, p = X.n_cols;
+  arma::rowvec mx = arma::mean(X, 0);
+  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
+  arma::Mat<eT> store;
+  StdDesign<eT> Z = stdDesign(X, mx, sx1, store);
+  storeStdStats(Z);
+  double my = arma::mean(Y);
+  Y -= my;
+  arma::vec betaHat = solver.cold(Z, Y, lambda, 1.0 / n);
+  unstandardize(betaHat, mx, sx1, my, p);
+  return betaHat;
+}
+
+// A path over lambdaSeq, each lambda warm-started from the previous solution and screened by the sequential strong rule, in the given order
+// from a cold start, or with descend in decreasing order from the intercept-only fit
+template <typename eT, typename Solver>
+arma::mat conquerHdSeq(const arma::mat& X, arma::vec Y, const arma::vec& lambdaSeq, const Solver& solver, const bool descend) {
+  const int n = X.n_rows, p = X.n_cols, nlambda = lambdaSeq.size();
+  const double n1 = 1.0 / n;
+  arma::rowvec mx = arma::mean(X, 0);
+  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
+  arma::Mat<eT> store;
+  StdDesign<eT> Z = stdDesign(X, mx, sx1, store);
+  storeStdStats(Z);
+  double my = arma::mean(Y);
+  Y -= my;
+  arma::mat betaSeq(p + 1, nlambda);
+  if (descend) {
+    descendPath(Z, Y, lambdaSeq, solver, n1, [&](const int i, const arma::vec& beta) {
+      betaSeq.col(i) = beta;
+    });
+  } else {
+    arma::vec betaHat = solver.cold(Z, Y, lambdaSeq(0), n1);
+    betaSeq.col(0) = betaHat;
+    for (int i = 1; i < nlambda; i++) {
+      betaHat = solver.warm(Z, Y, lambdaSeq(i), betaHat, n1, lambdaSeq(i - 1));
+      betaSeq.col(i) = betaHat;
+    }
+  }
+  unstandardize(betaSeq, mx, sx1, my, p);
+  return betaSeq;
+}
+
+// Cross-validation, the range of lambda is guided by the simulation-based mathod in Belloni & Chernozhukov (2011), AOS
+template <typename eT, typename Solver>
+Rcpp::List cvHd(const arma::mat& X, arma::vec Y, const arma::vec& lambdaSeq, const arma::vec& folds, const int kfolds, const Solver& solver,
+                const bool descend) {
+  const int n = X.n_rows, p = X.n_cols, nlambda = lambdaSeq.size();
+  const double tau = solver.ker.tau;
+  arma::vec betaHat(p + 1);
+  arma::vec dev = arma::zeros(nlambda);
+  arma::vec devsq = arma::zeros(nlambda);
+  arma::rowvec mx = arma::mean(X, 0);
+  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
+  arma::Mat<eT> store;
+  StdDesign<eT> Z = stdDesign(X, mx, sx1, store);
+  storeStdStats(Z);
+  double my = arma::mean(Y);
+  Y -= my;
+  for (int j = 1; j <= kfolds; j++) {
+    arma::uvec idx = arma::find(folds == j);
+    arma::uvec idxComp = arma::find(folds != j);
+    double n1Train = 1.0 / idxComp.size();
+    arma::Mat<eT> trainX = Z.X.rows(idxComp), testX = Z.X.rows(idx);
+    StdDesign<eT> trainZ = Z.with(trainX), testZ = Z.with(testX);
+    arma::vec trainY = Y.rows(idxComp), testY = Y.rows(idx);
+    storeStats(trainZ);
+    if (descend) {
+      descendPath(trainZ, trainY, lambdaSeq, solver, n1Train, [&](const int i, const arma::vec& beta) {
+        checkLoss(testZ, testY, beta, tau, i, dev, devsq);
+      });
+      continue;
+    }
+    betaHat = solver.cold(trainZ, trainY, lambdaSeq(0), n1Train);
+    checkLoss(testZ, testY, betaHat, tau, 0, dev, devsq);
+    for (int i = 1; i < nlambda; i++) {
+      betaHat = solver.warm(trainZ, trainY, lambdaSeq(i), betaHat, n1Train, lambdaSeq(i - 1));
+      checkLoss(testZ, testY, betaHat, tau, i, dev, devsq);
+    }
+  }
+  dev /= n;
+  devsq = arma::sqrt(devsq - n * arma::square(dev)) / n;
+  arma::uword cvIdx = arma::index_min(dev);
+  betaHat = solver.cold(Z, Y, lambdaSeq(cvIdx), 1.0 / n);
+  unstandardize(betaHat, mx, sx1, my, p);
+  const arma::uvec within = arma::find(dev <= dev(cvIdx) + devsq(cvIdx));
+  const arma::vec lambdaWithin = lambdaSeq(within);
+  arma::uword seIdx = within(arma::index_max(lambdaWithin));
+  arma::vec betaHatSe = solver.cold(Z, Y, lambdaSeq(seIdx), 1.0 / n);
+  unstandardize(betaHatSe, mx, sx1, my, p);
+  return Rcpp::List::create(Rcpp::Named("coeff") = betaHat, Rcpp::Named("coeffSe") = betaHatSe, Rcpp::Named("lambdaMin") = lambdaSeq(cvIdx),
+                            Rcpp::Named("lambdaSe") = lambdaSeq(seIdx), Rcpp::Named("deviance") = dev, Rcpp::Named("devianceSd") = devsq);
+}
+
+// Precision dispatch of the entry points
+template <typename Solver>
+arma::vec conquerHd(const arma::mat& X, const arma::vec& Y, const double lambda, const Solver& solver, const bool single) {
+  return single ? conquerHd<float>(X, Y, lambda, solver) : conquerHd<double>(X, Y, lambda, solver);
+}
+
+template <typename Solver>
+arma::mat conquerHdSeq(const arma::mat& X, const arma::vec& Y, const arma::vec& lambdaSeq, const Solver& solver, const bool single,
+                       const bool descend) {
+  return single ? conquerHdSeq<float>(X, Y, lambdaSeq, solver, descend) : conquerHdSeq<double>(X, Y, lambdaSeq, solver, descend);
+}
+
+template <typename Solver>
+Rcpp::List cvHd(const arma::mat& X, const arma::vec& Y, const arma::vec& lambdaSeq, const arma::vec& folds, const int kfolds, const Solver& solver,
+                const bool single, const bool descend) {
+  return single ? cvHd<float>(X, Y, lambdaSeq, folds, kfolds, solver, descend) : cvHd<double>(X, Y, lambdaSeq, folds, kfolds, solver, descend);
+}
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef KERNEL_H
+#define KERNEL_H
+
+# include <RcppArmadillo.h>
+# include <cmath>
+# include "basicOp.h"
+# include "vmath.h"
+// [[Rcpp::depends(RcppArmadillo)]]
+// [[Rcpp::plugins(cpp11)]]
+
+// Kernels of the convolution-type smoothed check loss. For a residual r, der(r) = K(-r / h) - tau is the derivative of the smoothed loss
+// with respect to the fitted value, where K is the integrated kernel. prepare() is called once before each pass over the residuals. A kernel is
+// local if der(r) depends on r only, so it can be evaluated inside a row panel before the other residuals are updated. The array form of der
+// fills a block of derivatives at once through the vectorized kernels in vmath.h. loss() sums the smoothed loss over a block of residuals and
+// writes the derivatives at the same time unless der is null; the high-dimensional solvers use it. hess(r) = K'(-r / h) / h is the derivative of
+// der with respect to the fitted value, the weight of an observation in the Hessian of the smoothed loss, and hessMax() is its maximum.
+struct GaussKernel {
+  static const bool local = true;
+  double tau, h, h1, h2;
+  GaussKernel(const double _tau, const double _h) : tau(_tau), h(_h), h1(1.0 / _h), h2(1.0 / (_h * _h)) {}
+  void prepare(const arma::vec& res) {}
+  double der(const double cur) const {
+    return vnormcdf(-h1 * cur) - tau;
+  }
+  double hess(const double cur) const {
+    return h1 * vnormpdf(h1 * cur);
+  }
+  double hessMax() const {
+    return 0.3989422804014327 * h1;
+  }
+  void der(const double* res, double* rst, const int len) const {
+    gaussDer(res, rst, len, tau, h1);
+  }
+  double loss(const double* res, double* der, const int len) const {
+    return gaussLoss(res, der, len, tau, h, h1, h2);
+  }
+};
+
+struct LogisticKernel {
+  static const bool local = true;
+  double tau, h, h1;
+  LogisticKernel(const double _tau, const double _h) : tau(_tau), h(_h), h1(1.0 / _h) {}
+  void prepare(const arma::vec& res) {}
+  double der(const double cur) const {
+    return vlogistic(h1 * cur) - tau;
+  }
+  double hess(const double cur) const {
+    const double v = vlogistic(h1 * cur);
+    return h1 * v * (1.0 - v);
+  }
+  double hessMax() const {
+    return 0.25 * h1;
+  }
+  void der(const double* res, double* rst, const int len) const {
+    logisticDer(res, rst, len, tau, h1);
+  }
+  double loss(const double* res, double* der, const int len) const {
+    return logisticLoss(res, der, len, tau, h, h1);
+  }
+};
+
+struct UnifKernel {
+  static const bool local = true;
+  double tau, h, h1;
+  UnifKernel(const double _tau, const double _h) : tau(_tau), h(_h), h1(1.0 / _h) {}
+  void prepare(const arma::vec& res) {}
+  double der(const double cur) const {
+    return 0.5 - tau - UnifPoly::der(clampUnit(h1 * cur));
+  }
+  double hess(const double cur) const {
+    return std::abs(h1 * cur) < 1.0 ? 0.5 * h1 : 0.0;
+  }
+  double hessMax() const {
+    return 0.5 * h1;
+  }
+  void der(const double* res, double* rst, const int len) const {
+    unifDer(res, rst, len, tau, h1);
+  }
+  double loss(const double* res, double* der, const int len) const {
+    return unifLoss(res, der, len, tau, h, h1);
+  }
+};
+
+struct ParaKernel {
+  static const bool local = true;
+  double tau, h, h1;
+  ParaKernel(const double _tau, const double _h) : tau(_tau), h(_h), h1(1.0 / _h) {}
+  void prepare(const arma::vec& res) {}
+  double der(const double cur) const {
+    return 0.5 - tau - ParaPoly::der(clampUnit(h1 * cur));
+  }
+  double hess(const double cur) const {
+    const double u = clampUnit(h1 * cur);
+    return 0.75 * h1 * (1.0 - u * u);
+  }
+  double hessMax() const {
+    return 0.75 * h1;
+  }
+  void der(const double* res, double* rst, const int len) const {
+    paraDer(res, rst, len, tau, h1);
+  }
+  double loss(const double* res, double* der, const int len) const {
+    return paraLoss(res, der, len, tau, h, h1);
+  }
+};
+
+struct TrianKernel {
+  static const bool local = true;
+  double tau, h, h1;
+  TrianKernel(const double _tau, const double _h) : tau(_tau), h(_h), h1(1.0 / _h) {}
+  void prepare(const arma::vec& res) {}
+  double der(const double cur) const {
+    return 0.5 - tau - TrianPoly::der(clampUnit(h1 * cur));
+  }
+  double hess(const double cur) const {
+    return h1 * (1.0 - std::abs(clampUnit(h1 * cur)));
+  }
+  double hessMax() const {
+    return h1;
+  }
+  void der(const double* res, double* rst, const int len) const {
+    trianDer(res, rst, len, tau, h1);
+  }
+  double loss(const double* res, double* der, const int len) const {
+    return trianLoss(res, der, len, tau, h, h1);
+  }
+};
+
+// Asymmetric huber loss adjusted to quantile tau, the robustification parameter is re-estimated from the residuals at every pass. The mad is
+// computed by selection in a work vector kept across passes.
+struct HuberKernel {
+  static const bool local = false;
+  double tau, constTau, rob;
+  arma::vec work;
+  HuberKernel(const double _tau, const double _constTau) : tau(_tau), constTau(_constTau), rob(0.0) {}
+  void prepare(const arma::vec& res) {
+    rob = constTau * mad(res, work);
+  }
+  double der(const double cur) const {
+    if (cur > rob) {
+      return -2 * tau * rob;
+    } else if (cur > 0) {
+      return -2 * tau * cur;
+    } else if (cur > -rob) {
+      return 2 * (tau - 1) * cur;
+    }
+    return 2 * (1 - tau) * rob;
+  }
+  void der(const double* res, double* rst, const int len) const {
+    for (int i = 0; i < len; i++) {
+      rst[i] = der(res[i]);
+    }
+  }
+};
+
+// Asymmetric squared loss adjusted to quantile tau, used by the L2 lasso that initializes the penalized fits. The loss is halved so that
+// der(r) = -w(r) * r is its derivative, with w(r) = tau for r > 0 and 1 - tau otherwise.
+struct L2Kernel {
+  double tau;
+  L2Kernel(const double _tau) : tau(_tau) {}
+  double loss(const double* res, double* der, const int len) const {
+    double rst = 0.0;
+    for (int i = 0; i < len; i++) {
+      double temp = res[i] > 0 ? tau : (1 - tau);
+      if (der != NULL) {
+        der[i] = -temp * res[i];
+      }
+      rst += temp * res[i] * res[i];
+    }
+    return 0.5 * rst;
+  }
+};
+
+// Kernel of a fit with observation weights, der_i = w_i * der(r_i), used by the multiplier bootstrap. The passes hand every block of residuals
+// to blockDer() with its first row i0, which picks the weights w_i0, ..., so the weighted kernel runs through the row-panel passes unchanged.
+template <typename Kernel>
+struct WeightedKernel {
+  static const bool local = Kernel::local;
+  Kernel ker;
+  const arma::vec& w;
+  WeightedKernel(const Kernel& _ker, const arma::vec& _w) : ker(_ker), w(_w) {}
+  void prepare(const arma::vec& res) {
+    ker.prepare(res);
+  }
+  void der(const double* res, double* rst, const int len, const int i0) const {
+    ker.der(res, rst, len);
+    const double* wi = w.memptr() + i0;
+    for (int i = 0; i < len; i++) {
+      rst[i] *= wi[i];
+    }
+  }
+};
+
+// Derivatives of the block of len residuals that starts at row i0 of the residual vector; only the weighted kernel needs i0
+template <typename Kernel>
+void blockDer(const Kernel& ker, const double* res, double* rst, const int len, const int i0) {
+  ker.der(res, rst, len);
+}
+
+template <typename Kernel>
+void blockDer(const WeightedKernel<Kernel>& ker, const double* res, double* rst, const int len, const int i0) {
+  ker.der(res, rst, len, i0);
+}
+
+// Step size rules of the Barzilai-Borwein gradient descent
+struct BoundedStep {
+  double stepMax;
+  BoundedStep(const double _stepMax) : stepMax(_stepMax) {}
+  double operator()(const double a1, const double a2) const {
+    return std::min(std::min(a1, a2), stepMax);
+  }
+};
+
+struct UnboundedStep {
+  double operator()(const double a1, const double a2) const {
+    return std::min(a1, a2);
+  }
+};
+
+#endif
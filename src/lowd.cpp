@@ -1,100 +1,96 @@
 # include <RcppArmadillo.h>
 # include <cmath>
 # include "basicOp.h"
+# include "kernel.h"
+# include "design.h"
+# include "rng.h"
 // [[Rcpp::depends(RcppArmadillo)]]
 // [[Rcpp::plugins(cpp11)]]
 
-// Asymmetric huber regression adjusted to quantile tau for initialization 
-// [[Rcpp::export]]
-void updateHuber(const arma::mat& Z, const arma::vec& res, const double tau, arma::vec& der, arma::vec& grad, const int n, const double rob, const double n1) {
-  for (int i = 0; i < n; i++) {
-    double cur = res(i);
-    if (cur > rob) {
-      der(i) = -2 * tau * rob;
-    } else if (cur > 0) {
-      der(i) = -2 * tau * cur;
-    } else if (cur > -rob) {
-      der(i) = 2 * (tau - 1) * cur;
-    } else {
-      der(i) = 2 * (1 - tau) * rob;
-    }
-  }
-  grad = n1 * Z.t() * der;
-}
-
-// Different kernels for low-dimensional conquer 
-// [[Rcpp::export]]
-void updateGauss(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const double tau, const double n1, const double h1) {
-  der = arma::normcdf(-res * h1) - tau;
-  grad = n1 * Z.t() * der;
-}
-
-// [[Rcpp::export]]
-void updateLogistic(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const double tau, const double n1, const double h1) {
-  der = 1.0 / (1.0 + arma::exp(res * h1)) - tau;
-  grad = n1 * Z.t() * der;
-}
-
-// [[Rcpp::export]]
-void updateUnif(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const int n, const double tau, const double h, 
-                const double n1, const double h1) {
-  for (int i = 0; i < n; i++) {
-    double cur = res(i);
-    if (cur <= -h) {
-      der(i) = 1 - tau;
-    } else if (cur < h) {
-      der(i) = 0.5 - tau - 0.5 * h1 * cur;
-    } else {
-      der(i) = -tau;
-    }
-  }
-  grad = n1 * Z.t() * der;
-}
-
-// [[Rcpp::export]]
-void updatePara(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const int n, const double tau, const double h, 
-                const double n1, const double h1, const double h3) {
-  for (int i = 0; i < n; i++) {
-    double cur = res(i);
-    if (cur <= -h) {
-      der(i) = 1 - tau;
-    } else if (cur < h) {
-      der(i) = 0.5 - tau - 0.75 * h1 * cur + 0.25 * h3 * cur * cur * cur;
-    } else {
-      der(i) = -tau;
-    }
-  }
-  grad = n1 * Z.t() * der;
+// Kernel derivatives of all residuals in one array pass, followed by the gradient Z^T der / n
+template <typename Kernel, typename Design>
+void updateKernel(const Design& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, Kernel& ker, const int n, const double n1) {
+  ker.prepare(res);
+  const double* r = res.memptr();
+  double* dr = der.memptr();
+  blockSum(n, [&](const int i0, const int i1) {
+    blockDer(ker, r + i0, dr + i0, i1 - i0, i0);
+    return 0.0;
+  });
+  gradient(Z, der, grad, n1);
 }
 
-// [[Rcpp::export]]
-void updateTrian(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const int n, const double tau, const double h, 
-                 const double n1, const double h1, const double h2) {
-  for (int i = 0; i < n; i++) {
-    double cur = res(i);
-    if (cur <= -h) {
-      der(i) = 1 - tau;
-    } else if (cur < 0) {
-      der(i) = 0.5 - tau - h1 * cur - 0.5 * h2 * cur * cur;
-    } else if (cur < h) {
-      der(i) = 0.5 - tau - h1 * cur + 0.5 * h2 * cur * cur;
-    } else {
-      der(i) = -tau;
+// Fused residual update, kernel derivative and gradient: res -= Z * betaDiff, der = K(-res / h) - tau and grad = Z^T der / n are computed panel 
+// by panel, so each row panel of Z is still in cache for the transposed product and Z is streamed once per iteration instead of twice. The 
+// panel holds about 256KB of Z. Kernels that are not local need every updated residual first and take the two-pass route. Each thread walks 
+// the panels of its own block of rows and keeps its own partial gradient. Z is stored as double or float, the products are accumulated in double.
+// The passes run over the stored matrix, the intercept and standardization of an implicit design are applied through fold() and unfold().
+template <typename Kernel, typename Design>
+void fusedUpdate(const Design& Z, const arma::vec& betaDiff, arma::vec& res, arma::vec& der, arma::vec& grad, Kernel& ker, const int n, 
+                 const double n1) {
+  typedef typename Design::elem_type eT;
+  if (!Kernel::local) {
+    matvecSub(Z, betaDiff, res);
+    updateKernel(Z, res, der, grad, ker, n, n1);
+    return;
+  }
+  const arma::Mat<eT>& A = stored(Z);
+  const int d = A.n_cols;
+  const int rows = std::max(64, 32768 / std::max(d, 1));
+  const int nt = passThreads(n);
+  arma::vec w;
+  const double c = fold(Z, betaDiff, w);
+  const double* bd = w.memptr();
+  double* r = res.memptr();
+  double* dr = der.memptr();
+  arma::mat part(d + 1, nt, arma::fill::zeros);
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int t = 0; t < nt; t++) {
+    const int b1 = blockBegin(n, t + 1, nt);
+    double* g = part.colptr(t);
+    for (int i0 = blockBegin(n, t, nt); i0 < b1; i0 += rows) {
+      const int i1 = std::min(b1, i0 + rows);
+      std::fill(dr + i0, dr + i1, c);
+      for (int j = 0; j < d; j++) {
+        const eT* zj = A.colptr(j);
+        const double bj = bd[j];
+        for (int i = i0; i < i1; i++) {
+          dr[i] += zj[i] * bj;
+        }
+      }
+      for (int i = i0; i < i1; i++) {
+        r[i] -= dr[i];
+      }
+      blockDer(ker, r + i0, dr + i0, i1 - i0, i0);
+      for (int j = 0; j < d; j++) {
+        const eT* zj = A.colptr(j);
+        double s = 0.0;
+        for (int i = i0; i < i1; i++) {
+          s += zj[i] * dr[i];
+        }
+        g[j] += s;
+      }
+      double s = 0.0;
+      for (int i = i0; i < i1; i++) {
+        s += dr[i];
+      }
+      g[d] += s;
     }
   }
-  grad = n1 * Z.t() * der;
+  arma::vec raw = arma::sum(part, 1);
+  unfold(Z, raw.head(d), raw(d), grad);
+  grad *= n1;
 }
 
-// Functions with an upper bound for the GD step size.
-// [[Rcpp::export]]
-arma::vec huberReg(const arma::mat& Z, const arma::vec& Y, const double tau, arma::vec& der, arma::vec& gradOld, arma::vec& gradNew, const int n, const int p, 
-                   const double n1, const double tol = 0.0001, const double constTau = 1.345, const int iteMax = 5000, const double stepMax = 100.0) {
-  double rob = constTau * mad(Y);
-  updateHuber(Z, Y, tau, der, gradOld, n, rob, n1);
-  arma::vec beta = -gradOld, betaDiff = -gradOld;
-  arma::vec res = Y - Z * beta;
-  rob = constTau * mad(res);
-  updateHuber(Z, res, tau, der, gradNew, n, rob, n1);
+// Barzilai-Borwein gradient descent shared by all kernels and step size rules. On entry res = Y - Z * beta, on exit beta and res hold the 
+// final iterate. The number of iterations is returned.
+template <typename Kernel, typename Step, typename Design>
+int bbDescent(const Design& Z, arma::vec& beta, arma::vec& res, arma::vec& der, arma::vec& gradOld, arma::vec& gradNew, Kernel& ker, 
+              const Step& step, const int n, const double n1, const double tol, const int iteMax) {
+  updateKernel(Z, res, der, gradOld, ker, n, n1);
+  beta -= gradOld;
+  arma::vec betaDiff = -gradOld;
+  fusedUpdate(Z, betaDiff, res, der, gradNew, ker, n, n1);
   arma::vec gradDiff = gradNew - gradOld;
   int ite = 1;
   while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
@@ -103,2156 +99,1236 @@ arma::vec huberReg(const arma::mat& Z, const arma::vec& Y, const double tau, arm
     if (cross > 0) {
       double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
       double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
+      alpha = step(a1, a2);
     }
     gradOld = gradNew;
     betaDiff = -alpha * gradNew;
     beta += betaDiff;
-    res -= Z * betaDiff;
-    rob = constTau * mad(res);
-    updateHuber(Z, res, tau, der, gradNew, n, rob, n1);
+    fusedUpdate(Z, betaDiff, res, der, gradNew, ker, n, n1);
     gradDiff = gradNew - gradOld;
     ite++;
   }
+  return ite;
+}
+
+// Asymmetric huber regression adjusted to quantile tau for initialization, starting from zero
+template <typename Step, typename Design>
+arma::vec huberDescent(const Design& Z, const arma::vec& Y, const double tau, arma::vec& der, arma::vec& gradOld, arma::vec& gradNew, const int n, 
+                       const int p, const double n1, const double tol, const double constTau, const int iteMax, const Step& step) {
+  arma::vec beta = arma::zeros(p + 1);
+  arma::vec res = Y;
+  HuberKernel ker(tau, constTau);
+  bbDescent(Z, beta, res, der, gradOld, gradNew, ker, step, n, n1, tol, iteMax);
   return beta;
 }
 
-// Low-dimensional conquer: estimation
-// [[Rcpp::export]]
-Rcpp::List smqrGauss(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                     const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+// Huber initialization with the intercept reset to the tau-quantile of the partial residuals
+template <typename Step, typename Design>
+arma::vec smqrStart(const Design& Z, const arma::vec& Y, const double tau, arma::vec& der, arma::vec& gradOld, arma::vec& gradNew, const int n, 
+                    const int p, const double n1, const double tol, const double constTau, const int iteMax, const Step& step) {
+  arma::vec beta = huberDescent(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, step);
+  arma::vec res;
+  beta(0) = 0.0;
+  residual(Z, Y, beta, res);
+  beta(0) = quantileSelect(res.memptr(), res.n_elem, tau);
+  return beta;
+}
+
+// Conquer fit on a design Z with the intercept column, from the huber initialization. On exit res holds the final residuals, the number of
+// iterations is returned.
+template <typename Kernel, typename Step, typename Design>
+int smqrSolve(const Design& Z, const arma::vec& Y, const double tau, const double h, const double constTau, const double tol, const int iteMax, 
+              const Step& step, arma::vec& beta, arma::vec& res) {
+  const int n = Z.n_rows;
+  const int p = Z.n_cols - 1;
+  const double n1 = 1.0 / n;
+  arma::vec der(n);
+  arma::vec gradOld(p + 1), gradNew(p + 1);
+  beta = smqrStart(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, step);
+  residual(Z, Y, beta, res);
+  Kernel ker(tau, h);
+  return bbDescent(Z, beta, res, der, gradOld, gradNew, ker, step, n, n1, tol, iteMax);
+}
+
+// Low-dimensional conquer engine: estimation with implicit standardization of X. With single = true the standardized design is stored in single
+// precision.
+template <typename Kernel, typename Step>
+Rcpp::List smqrFit(const arma::mat& X, arma::vec Y, const double tau, double h, const double constTau, const double tol, const int iteMax, 
+                   const Step& step, const bool single) {
   const int n = X.n_rows;
   const int p = X.n_cols;
   if (h <= 0.0) {
     h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
   }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
   arma::rowvec mx = arma::mean(X, 0);
   arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
   double my = arma::mean(Y);
   Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateGauss(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateGauss(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateGauss(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
+  arma::vec beta, res;
+  int ite;
+  if (single) {
+    arma::fmat store;
+    ite = smqrSolve<Kernel>(stdDesign(X, mx, sx1, store), Y, tau, h, constTau, tol, iteMax, step, beta, res);
+  } else {
+    arma::mat store;
+    ite = smqrSolve<Kernel>(stdDesign(X, mx, sx1, store), Y, tau, h, constTau, tol, iteMax, step, beta, res);
+  }
+  unstandardize(beta, mx, sx1, my, p);
   return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
 }
 
-// [[Rcpp::export]]
-Rcpp::List smqrGaussNsd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+// Estimation with a design matrix Z that already contains the intercept column, without standardization
+template <typename Kernel, typename Step>
+Rcpp::List smqrFitNsd(const arma::mat& Z, const arma::vec& Y, const double tau, double h, const double constTau, const double tol, const int iteMax, 
+                      const Step& step) {
   const int n = Z.n_rows;
   const int p = Z.n_cols - 1;
   if (h <= 0.0) {
     h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
   }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateGauss(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateGauss(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateGauss(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
+  arma::vec beta, res;
+  int ite = smqrSolve<Kernel>(Z, Y, tau, h, constTau, tol, iteMax, step, beta, res);
   return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
 }
 
-// [[Rcpp::export]]
-arma::vec smqrGaussIni(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
-                       const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+// Estimation started from a given initial value betaHat
+template <typename Kernel, typename Step>
+arma::vec smqrFitIni(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau, double h, const double tol, 
+                     const int iteMax, const Step& step) {
   const int n = X.n_rows;
   if (h <= 0.0) {
     h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
   }
   const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
   arma::rowvec mx = arma::mean(X, 0);
   arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
+  StdDesign<double> Z(X, mx, sx1);
   double my = arma::mean(Y);
   Y -= my;
   arma::vec der(n);
   arma::vec gradOld(p + 1), gradNew(p + 1);
   arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updateGauss(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateGauss(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateGauss(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
+  arma::vec res;
+  residual(Z, Y, beta, res);
+  Kernel ker(tau, h);
+  bbDescent(Z, beta, res, der, gradOld, gradNew, ker, step, n, n1, tol, iteMax);
+  unstandardize(beta, mx, sx1, my, p);
   return beta;
 }
 
-// [[Rcpp::export]]
-Rcpp::List smqrLogistic(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+// Conquer fit warm-started from the fit at a neighboring quantile level, with res = Y - Z * beta on entry. The slopes are kept and the intercept
+// is shifted to the tau-quantile of the residuals. Only if the descent then fails to converge, the fit is restarted from the huber
+// initialization. On exit res holds the final residuals, the number of iterations including a restart is returned.
+template <typename Kernel, typename Step, typename Design>
+int smqrWarm(const Design& Z, const arma::vec& Y, const double tau, const double h, const double constTau, const double tol, const int iteMax, 
+             const Step& step, arma::vec& beta, arma::vec& res, arma::vec& der, arma::vec& gradOld, arma::vec& gradNew, arma::vec& work) {
+  const int n = Z.n_rows;
+  const double n1 = 1.0 / n;
+  work = res;
+  const double shift = quantileSelect(work.memptr(), n, tau);
+  beta(0) += shift;
+  res -= shift;
+  Kernel ker(tau, h);
+  int ite = bbDescent(Z, beta, res, der, gradOld, gradNew, ker, step, n, n1, tol, iteMax);
+  if (!beta.is_finite() || !(arma::norm(gradNew, "inf") <= tol)) {
+    ite += smqrSolve<Kernel>(Z, Y, tau, h, constTau, tol, iteMax, step, beta, res);
+  }
+  return ite;
+}
+
+// Fits of the quantile levels i0, ..., i1 - 1 of tauSeq on the design Z, one column of betaProc each. The first level starts from the huber
+// initialization and every following one from its predecessor, the number of iterations of each level is stored in ite.
+template <typename Kernel, typename Step, typename Design>
+void smqrSolveBlock(const Design& Z, const arma::vec& Y, const arma::vec& tauSeq, const int i0, const int i1, const double h, const double constTau, 
+                    const double tol, const int iteMax, const Step& step, arma::mat& betaProc, arma::vec& ite) {
+  const int n = Z.n_rows;
+  const int p = Z.n_cols - 1;
+  arma::vec der(n), work(n);
+  arma::vec gradOld(p + 1), gradNew(p + 1);
+  arma::vec beta, res;
+  ite(i0) = smqrSolve<Kernel>(Z, Y, tauSeq(i0), h, constTau, tol, iteMax, step, beta, res);
+  betaProc.col(i0) = beta;
+  for (int i = i0 + 1; i < i1; i++) {
+    ite(i) = smqrWarm<Kernel>(Z, Y, tauSeq(i), h, constTau, tol, iteMax, step, beta, res, der, gradOld, gradNew, work);
+    betaProc.col(i) = beta;
+  }
+}
+
+// Fits of every quantile level in tauSeq on the design Z. With parTau = true the grid is cut into one contiguous block of levels per thread,
+// warm-started within the block. Every thread keeps its own workspace and reads the shared Z, and its passes over the data run on the
+// thread itself. Each block starts from the huber initialization, so the fits agree with the serial process up to the tolerance.
+template <typename Kernel, typename Step, typename Design>
+void smqrSolveProc(const Design& Z, const arma::vec& Y, const arma::vec& tauSeq, const double h, const double constTau, const double tol, 
+                   const int iteMax, const Step& step, const bool parTau, arma::mat& betaProc, arma::vec& ite) {
+  const int m = tauSeq.size();
+  const int nt = parTau ? std::max(1, std::min(conquerThreads(), m)) : 1;
+  if (nt == 1) {
+    smqrSolveBlock<Kernel>(Z, Y, tauSeq, 0, m, h, constTau, tol, iteMax, step, betaProc, ite);
+    return;
+  }
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int t = 0; t < nt; t++) {
+    smqrSolveBlock<Kernel>(Z, Y, tauSeq, blockBegin(m, t, nt), blockBegin(m, t + 1, nt), h, constTau, tol, iteMax, step, betaProc, ite);
+  }
+}
+
+// Conquer process with a quantile grid
+template <typename Kernel, typename Step>
+Rcpp::List smqrFitProc(const arma::mat& X, arma::vec Y, const arma::vec& tauSeq, double h, const double constTau, const double tol, const int iteMax, 
+                       const Step& step, const bool single, const bool parTau) {
   const int n = X.n_rows;
   const int p = X.n_cols;
+  const int m = tauSeq.size();
   if (h <= 0.0) {
     h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
   }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
   arma::rowvec mx = arma::mean(X, 0);
   arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
   double my = arma::mean(Y);
   Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateLogistic(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
+  arma::mat betaProc(p + 1, m);
+  arma::vec ite(m);
+  if (single) {
+    arma::fmat store;
+    smqrSolveProc<Kernel>(stdDesign(X, mx, sx1, store), Y, tauSeq, h, constTau, tol, iteMax, step, parTau, betaProc, ite);
+  } else {
+    arma::mat store;
+    smqrSolveProc<Kernel>(stdDesign(X, mx, sx1, store), Y, tauSeq, h, constTau, tol, iteMax, step, parTau, betaProc, ite);
+  }
+  unstandardize(betaProc, mx, sx1, my, p);
+  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("ite") = ite, Rcpp::Named("bandwidth") = h);
+}
+
+// Multiplier weights with mean 1 and variance 1 from the random stream rng, drawn in place: Bernoulli on {0, 2} (multiplier = 0), which refits
+// a random half-sample, standard exponential (1) or N(1, 1) (2)
+void multiplierWeights(arma::vec& w, const int multiplier, const CounterRng& rng) {
+  const int n = w.n_elem;
+  double* wi = w.memptr();
+  if (multiplier == 1) {
+    for (int i = 0; i < n; i++) {
+      wi[i] = -std::log(rng.uniform(i));
+    }
+  } else if (multiplier == 2) {
+    for (int i = 0; i < n; i++) {
+      wi[i] = 1.0 + rng.normal(i);
+    }
+  } else {
+    for (int i = 0; i < n; i++) {
+      wi[i] = rng.uniform(i) < 0.5 ? 0.0 : 2.0;
     }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
   }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
 }
 
-// [[Rcpp::export]]
-Rcpp::List smqrLogisticNsd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                           const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+// Weighted kernel derivatives Der = W % der(Res) and gradients Grad = Z^T Der / n of the replicates in the first ka columns, the products with
+// the design are matrix products over all ka replicates at once
+template <typename Kernel>
+void batchGradient(const StdDesign<double>& Z, arma::mat& Res, arma::mat& W, arma::mat& Der, arma::mat& Grad, const Kernel& ker, const int ka, 
+                   const double n1) {
   const int n = Z.n_rows;
-  const int p = Z.n_cols - 1;
+  const int p = Z.X.n_cols;
+  arma::mat R(Res.memptr(), n, ka, false, true), D(Der.memptr(), n, ka, false, true), G(Grad.memptr(), p + 1, ka, false, true);
+  const int nt = std::max(1, std::min(conquerThreads(), ka));
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int j = 0; j < ka; j++) {
+    double* dj = D.colptr(j);
+    const double* wj = W.colptr(j);
+    ker.der(R.colptr(j), dj, n);
+    for (int i = 0; i < n; i++) {
+      dj[i] *= wj[i];
+    }
+  }
+  arma::mat raw = Z.X.t() * D;
+  arma::rowvec s = arma::sum(D, 0);
+  raw -= Z.mx.t() * s;
+  raw.each_col() %= Z.sx1;
+  G.row(0) = s;
+  G.tail_rows(p) = raw;
+  G *= n1;
+}
+
+// Res -= Z * BetaDiff for the replicates in the first ka columns as one matrix product, followed by their weighted gradients
+template <typename Kernel>
+void batchUpdate(const StdDesign<double>& Z, arma::mat& BetaDiff, arma::mat& Res, arma::mat& W, arma::mat& Der, arma::mat& Grad, const Kernel& ker, 
+                 const int ka, const double n1) {
+  const int n = Z.n_rows;
+  const int p = Z.X.n_cols;
+  arma::mat Bd(BetaDiff.memptr(), p + 1, ka, false, true), R(Res.memptr(), n, ka, false, true);
+  arma::mat Wf = Bd.tail_rows(p);
+  Wf.each_col() %= Z.sx1;
+  arma::rowvec c = Bd.row(0) - Z.mx * Wf;
+  R -= Z.X * Wf;
+  R.each_row() -= c;
+  batchGradient(Z, Res, W, Der, Grad, ker, ka, n1);
+}
+
+// Multiplier bootstrap in blocks of k replicates advanced in lockstep: every Barzilai-Borwein iteration of a block updates all its residuals
+// and gradients with two matrix products, so the design is streamed once per iteration for the whole block. The step sizes are kept per
+// replicate. A replicate that has converged is written to rst and dropped by moving the last active replicate into its columns. The replicates
+// b0, ..., b1 - 1 are run, the columns of rst are on the standardized scale.
+template <typename Kernel, typename Step>
+void smqrInfBatch(const StdDesign<double>& Z, const arma::vec& beta0, const arma::vec& res0, const double tau, const double h, const double tol, 
+                  const int iteMax, const Step& step, const int multiplier, const int seed, const int k, const int b0, const int b1, arma::mat& rst) {
+  const int n = Z.n_rows;
+  const int d = Z.n_cols;
+  const double n1 = 1.0 / n;
+  Kernel ker(tau, h);
+  arma::mat W(n, k), Res(n, k), Der(n, k);
+  arma::mat Beta(d, k), BetaDiff(d, k), GradOld(d, k), GradNew(d, k);
+  std::vector<int> id(k), ite(k);
+  for (int c0 = b0; c0 < b1; c0 += k) {
+    int ka = std::min(k, b1 - c0);
+    for (int j = 0; j < ka; j++) {
+      arma::vec wj(W.colptr(j), n, false, true);
+      multiplierWeights(wj, multiplier, CounterRng((uint32_t)seed, c0 + j));
+      Res.col(j) = res0;
+      Beta.col(j) = beta0;
+      id[j] = c0 + j;
+      ite[j] = 1;
+    }
+    batchGradient(Z, Res, W, Der, GradOld, ker, ka, n1);
+    Beta.head_cols(ka) -= GradOld.head_cols(ka);
+    BetaDiff.head_cols(ka) = -GradOld.head_cols(ka);
+    batchUpdate(Z, BetaDiff, Res, W, Der, GradNew, ker, ka, n1);
+    while (true) {
+      for (int j = ka - 1; j >= 0; j--) {
+        if (!(arma::norm(GradNew.col(j), "inf") > tol && ite[j] <= iteMax)) {
+          rst.col(id[j]) = Beta.col(j);
+          ka--;
+          if (j < ka) {
+            W.col(j) = W.col(ka);
+            Res.col(j) = Res.col(ka);
+            Beta.col(j) = Beta.col(ka);
+            BetaDiff.col(j) = BetaDiff.col(ka);
+            GradOld.col(j) = GradOld.col(ka);
+            GradNew.col(j) = GradNew.col(ka);
+            id[j] = id[ka];
+            ite[j] = ite[ka];
+          }
+        }
+      }
+      if (ka == 0) {
+        break;
+      }
+      for (int j = 0; j < ka; j++) {
+        double alpha = 1.0;
+        arma::vec gradDiff = GradNew.col(j) - GradOld.col(j);
+        double cross = arma::dot(BetaDiff.col(j), gradDiff);
+        if (cross > 0) {
+          double a1 = cross / arma::dot(gradDiff, gradDiff);
+          double a2 = arma::dot(BetaDiff.col(j), BetaDiff.col(j)) / cross;
+          alpha = step(a1, a2);
+        }
+        GradOld.col(j) = GradNew.col(j);
+        BetaDiff.col(j) = -alpha * GradNew.col(j);
+        Beta.col(j) += BetaDiff.col(j);
+        ite[j]++;
+      }
+      batchUpdate(Z, BetaDiff, Res, W, Der, GradNew, ker, ka, n1);
+    }
+  }
+}
+
+// Upper Cholesky factor R, with R^T R the smoothed Hessian Z^T diag(hess(res)) Z / n of the linearized bootstrap at the residuals res0 of betaHat
+template <typename Kernel>
+arma::mat smqrHessianChol(const StdDesign<double>& Z, const arma::vec& res0, const double tau, const double h) {
+  const int n = Z.n_rows;
+  const double n1 = 1.0 / n;
+  Kernel ker(tau, h);
+  arma::vec q(n);
+  for (int i = 0; i < n; i++) {
+    q(i) = n1 * ker.hess(res0(i));
+  }
+  arma::mat H;
+  weightedGram(Z, q, H);
+  arma::mat R;
+  if (!arma::chol(R, H)) {
+    Rcpp::stop("the smoothed hessian is singular");
+  }
+  return R;
+}
+
+// One-step bootstrap: with the Cholesky factor R of the Hessian H computed once at betaHat, every replicate takes newton steps beta -= H^{-1} grad
+// from betaHat with its weighted gradient, two triangular solves and one pass over the data per step instead of a full descent. The weights
+// are drawn from the same streams as the full bootstrap, so both can be compared replicate by replicate. The replicates b0, ..., b1 - 1 are
+// spread over the threads.
+template <typename Kernel>
+void smqrInfNewton(const StdDesign<double>& Z, const arma::vec& beta0, const arma::vec& res0, const arma::mat& R, const double tau, 
+                   const double h, const int multiplier, const int seed, const int newton, const int b0, const int b1, arma::mat& rst) {
+  const int n = Z.n_rows;
+  const int d = Z.n_cols;
+  const double n1 = 1.0 / n;
+  Kernel ker(tau, h);
+  const arma::mat Rt = R.t();
+  const int nt = std::max(1, std::min(conquerThreads(), b1 - b0));
+  #pragma omp parallel num_threads(nt)
+  {
+    arma::vec w(n), der(n), res(n), beta(d), grad(d);
+    #pragma omp for schedule(dynamic)
+    for (int b = b0; b < b1; b++) {
+      multiplierWeights(w, multiplier, CounterRng((uint32_t)seed, b));
+      beta = beta0;
+      for (int s = 0; s < newton; s++) {
+        res = res0;
+        if (s > 0) {
+          matvecSub(Z, beta - beta0, res);
+        }
+        WeightedKernel<Kernel> wker(ker, w);
+        updateKernel(Z, res, der, grad, wker, n, n1);
+        beta -= arma::solve(arma::trimatu(R), arma::solve(arma::trimatl(Rt), grad));
+      }
+      rst.col(b) = beta;
+    }
+  }
+}
+
+// Full refits of the replicates b0, ..., b1 - 1, spread over the threads. Each thread reuses its own weight, residual, derivative and gradient
+// vectors and runs the passes of its replicates by itself.
+template <typename Kernel, typename Step>
+void smqrInfRefit(const StdDesign<double>& Z, const arma::vec& beta0, const arma::vec& res0, const double tau, const double h, const double tol, 
+                  const int iteMax, const Step& step, const int multiplier, const int seed, const int b0, const int b1, arma::mat& rst) {
+  const int n = Z.n_rows;
+  const int d = Z.n_cols;
+  const double n1 = 1.0 / n;
+  const int nt = std::max(1, std::min(conquerThreads(), b1 - b0));
+  #pragma omp parallel num_threads(nt)
+  {
+    arma::vec w(n), der(n), res(n), beta(d);
+    arma::vec gradOld(d), gradNew(d);
+    #pragma omp for schedule(dynamic)
+    for (int b = b0; b < b1; b++) {
+      multiplierWeights(w, multiplier, CounterRng((uint32_t)seed, b));
+      beta = beta0;
+      res = res0;
+      WeightedKernel<Kernel> ker(Kernel(tau, h), w);
+      bbDescent(Z, beta, res, der, gradOld, gradNew, ker, step, n, n1, tol, iteMax);
+      rst.col(b) = beta;
+    }
+  }
+}
+
+// Largest Monte-Carlo standard error of the bootstrap endpoints, the alpha / 2 and 1 - alpha / 2 quantiles of the first B replicates of each
+// coefficient, relative to the bootstrap standard deviation of the coefficient. The error of the prob-quantile is estimated by half the distance
+// between the order statistics one binomial standard deviation sqrt(B * prob * (1 - prob)) below and above it, found by selection.
+double bootMcError(const arma::mat& rst, const int B, const double alpha, arma::vec& work) {
+  const double probs[2] = {0.5 * alpha, 1.0 - 0.5 * alpha};
+  double rst1 = 0.0;
+  for (arma::uword j = 0; j < rst.n_rows; j++) {
+    work = rst(arma::span(j), arma::span(0, B - 1)).t();
+    const double sd = arma::stddev(work);
+    if (sd <= 0.0) {
+      continue;
+    }
+    for (const double prob : probs) {
+      const double delta = std::sqrt(prob * (1.0 - prob) / B);
+      const double lo = quantileSelect(work.memptr(), B, prob - delta);
+      const double hi = quantileSelect(work.memptr(), B, prob + delta);
+      rst1 = std::max(rst1, 0.5 * (hi - lo) / sd);
+    }
+  }
+  return rst1;
+}
+
+// Replicates of the adaptive bootstrap before its first check and between two checks
+const int mcStart = 200, mcStep = 100;
+
+// Bootstrap confidence intervals at level 1 - alpha from the replicates boot of the estimate est, one row per coefficient: percentile
+// intervals from the alpha / 2 and 1 - alpha / 2 quantiles of the replicates, found by selection in one work vector with the interpolation of
+// R's quantile, pivotal intervals reflected around est and normal intervals from the bootstrap standard errors. The replicate matrix is only
+// returned with keep = true.
+Rcpp::List bootCI(const arma::mat& boot, const arma::vec& est, const double alpha, const bool keep) {
+  const int d = boot.n_rows;
+  const int B = boot.n_cols;
+  const double z = R::qnorm(1.0 - 0.5 * alpha, 0.0, 1.0, 1, 0);
+  arma::mat perCI(d, 2), pivCI(d, 2), normCI(d, 2);
+  arma::vec se(d);
+  arma::vec work(B);
+  for (int j = 0; j < d; j++) {
+    work = boot.row(j).t();
+    se(j) = arma::stddev(work);
+    const double q1 = quantileSelectR(work.memptr(), B, 0.5 * alpha);
+    const double q2 = quantileSelectR(work.memptr(), B, 1.0 - 0.5 * alpha);
+    perCI(j, 0) = q1;
+    perCI(j, 1) = q2;
+    pivCI(j, 0) = 2 * est(j) - q2;
+    pivCI(j, 1) = 2 * est(j) - q1;
+    normCI(j, 0) = est(j) - z * se(j);
+    normCI(j, 1) = est(j) + z * se(j);
+  }
+  Rcpp::List rst = Rcpp::List::create(Rcpp::Named("perCI") = perCI, Rcpp::Named("pivCI") = pivCI, Rcpp::Named("normCI") = normCI, 
+                                      Rcpp::Named("se") = se, Rcpp::Named("B") = B);
+  if (keep) {
+    rst["boot"] = boot;
+  }
+  return rst;
+}
+
+// Conquer with multiplier bootstrap inference. Every replicate minimizes the weighted smoothed loss sum_i w_i * l(y_i - z_i^T beta) on the
+// full standardized design, started from betaHat. The standardization, the centered response and the residuals at betaHat are computed once.
+// By default the replicates are refitted in parallel by smqrInfRefit. Replicate b draws its weights from the stream b of seed, so the result
+// is the same for any number of threads. With batch > 1 blocks of batch replicates are advanced together by smqrInfBatch, which draws the same
+// weights and agrees with the default up to the tolerance. With newton > 0 the replicates are linearized around betaHat instead, see
+// smqrInfNewton. With mcTol > 0, B is an upper bound: replicates are added in rounds until the Monte-Carlo error of every percentile endpoint at
+// level alpha is below mcTol bootstrap standard deviations. The intervals at level alpha are assembled by bootCI.
+template <typename Kernel, typename Step>
+Rcpp::List smqrFitInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h, const double tau, const int B, 
+                     const double tol, const int iteMax, const Step& step, const int multiplier, const int seed, const int batch, const int newton, 
+                     const double alpha, const double mcTol, const bool keep) {
+  arma::mat rst(p + 1, B);
   if (h <= 0.0) {
     h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
   }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateLogistic(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
+  arma::rowvec mx = arma::mean(X, 0);
+  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
+  StdDesign<double> Z(X, mx, sx1);
+  double my = arma::mean(Y);
+  arma::vec Yc = Y - my;
+  arma::vec beta0 = betaHat;
+  standardizeCoef(beta0, mx, sx1, my, p);
+  arma::vec res0;
+  residual(Z, Yc, beta0, res0);
+  arma::mat R;
+  if (newton > 0) {
+    R = smqrHessianChol<Kernel>(Z, res0, tau, h);
+  }
+  auto run = [&](const int b0, const int b1) {
+    if (newton > 0) {
+      smqrInfNewton<Kernel>(Z, beta0, res0, R, tau, h, multiplier, seed, newton, b0, b1, rst);
+    } else if (batch > 1) {
+      smqrInfBatch<Kernel>(Z, beta0, res0, tau, h, tol, iteMax, step, multiplier, seed, std::min(batch, b1 - b0), b0, b1, rst);
+    } else {
+      smqrInfRefit<Kernel>(Z, beta0, res0, tau, h, tol, iteMax, step, multiplier, seed, b0, b1, rst);
     }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
+  };
+  int used = B;
+  if (mcTol > 0.0) {
+    arma::vec work;
+    used = std::min(B, mcStart);
+    run(0, used);
+    while (used < B && bootMcError(rst, used, alpha, work) > mcTol) {
+      const int b1 = std::min(B, used + mcStep);
+      run(used, b1);
+      used = b1;
+    }
+    rst.resize(p + 1, used);
+  } else {
+    run(0, B);
   }
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+  unstandardize(rst, mx, sx1, my, p);
+  return bootCI(rst, betaHat, alpha, keep);
 }
 
-// [[Rcpp::export]]
-arma::vec smqrLogisticIni(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
-                          const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+// Multiplier bootstrap of the conquer process betaProc on the grid tauSeq. Replicate b draws its weight vector once from the stream b of seed
+// and reuses it at every quantile level, each level started from the point estimate of the process. The replicates are spread over the
+// threads as in smqrInfRefit. Pointwise bands are normal bands from the bootstrap standard errors. Uniform bands over the grid scale the
+// standard errors of each coefficient by the 1 - alpha quantile of its sup-t statistic max_k |beta*_k - betaHat_k| / se_k over the replicates.
+template <typename Kernel, typename Step>
+Rcpp::List smqrFitProcInf(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h, const int B, 
+                          const double tol, const int iteMax, const Step& step, const int multiplier, const int seed, const double alpha) {
   const int n = X.n_rows;
+  const int p = X.n_cols;
+  const int m = tauSeq.size();
   if (h <= 0.0) {
     h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
   }
   const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
   arma::rowvec mx = arma::mean(X, 0);
   arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
+  StdDesign<double> Z(X, mx, sx1);
   double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updateLogistic(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
+  arma::vec Yc = Y - my;
+  arma::mat beta0 = betaProc;
+  standardizeCoef(beta0, mx, sx1, my, p);
+  arma::cube boot(p + 1, m, B);
+  const int nt = std::max(1, std::min(conquerThreads(), B));
+  #pragma omp parallel num_threads(nt)
+  {
+    arma::vec w(n), der(n), res(n), beta(p + 1);
+    arma::vec gradOld(p + 1), gradNew(p + 1);
+    #pragma omp for schedule(dynamic)
+    for (int b = 0; b < B; b++) {
+      multiplierWeights(w, multiplier, CounterRng((uint32_t)seed, b));
+      for (int k = 0; k < m; k++) {
+        beta = beta0.col(k);
+        residual(Z, Yc, beta, res);
+        WeightedKernel<Kernel> ker(Kernel(tauSeq(k), h), w);
+        bbDescent(Z, beta, res, der, gradOld, gradNew, ker, step, n, n1, tol, iteMax);
+        boot.slice(b).col(k) = beta;
+      }
+      unstandardize(boot.slice(b), mx, sx1, my, p);
     }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
   }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return beta;
+  arma::mat se(p + 1, m);
+  arma::vec work(B);
+  for (int k = 0; k < m; k++) {
+    for (int j = 0; j <= p; j++) {
+      for (int b = 0; b < B; b++) {
+        work(b) = boot(j, k, b);
+      }
+      se(j, k) = arma::stddev(work);
+    }
+  }
+  arma::vec crit(p + 1);
+  for (int j = 0; j <= p; j++) {
+    for (int b = 0; b < B; b++) {
+      double t = 0.0;
+      for (int k = 0; k < m; k++) {
+        if (se(j, k) > 0) {
+          t = std::max(t, std::abs(boot(j, k, b) - betaProc(j, k)) / se(j, k));
+        }
+      }
+      work(b) = t;
+    }
+    crit(j) = quantileSelectR(work.memptr(), B, 1.0 - alpha);
+  }
+  const double z = R::qnorm(1.0 - 0.5 * alpha, 0.0, 1.0, 1, 0);
+  arma::mat width = se;
+  width.each_col() %= crit;
+  arma::mat pointLower = betaProc - z * se, pointUpper = betaProc + z * se;
+  arma::mat unifLower = betaProc - width, unifUpper = betaProc + width;
+  return Rcpp::List::create(Rcpp::Named("se") = se, Rcpp::Named("pointLower") = pointLower, Rcpp::Named("pointUpper") = pointUpper, 
+                            Rcpp::Named("unifLower") = unifLower, Rcpp::Named("unifUpper") = unifUpper, Rcpp::Named("crit") = crit);
+}
+
+// Asymmetric huber regression adjusted to quantile tau for initialization 
+// [[Rcpp::export]]
+void updateHuber(const arma::mat& Z, const arma::vec& res, const double tau, arma::vec& der, arma::vec& grad, const int n, const double rob, const double n1) {
+  HuberKernel ker(tau, 0.0);
+  ker.rob = rob;
+  ker.der(res.memptr(), der.memptr(), n);
+  gradient(Z, der, grad, n1);
+}
+
+// Different kernels for low-dimensional conquer 
+// [[Rcpp::export]]
+void updateGauss(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const double tau, const double n1, const double h1) {
+  GaussKernel ker(tau, 1.0 / h1);
+  updateKernel(Z, res, der, grad, ker, res.n_elem, n1);
+}
+
+// [[Rcpp::export]]
+void updateLogistic(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const double tau, const double n1, const double h1) {
+  LogisticKernel ker(tau, 1.0 / h1);
+  updateKernel(Z, res, der, grad, ker, res.n_elem, n1);
+}
+
+// [[Rcpp::export]]
+void updateUnif(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const int n, const double tau, const double h, 
+                const double n1, const double h1) {
+  UnifKernel ker(tau, h);
+  updateKernel(Z, res, der, grad, ker, n, n1);
+}
+
+// [[Rcpp::export]]
+void updatePara(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const int n, const double tau, const double h, 
+                const double n1, const double h1, const double h3) {
+  ParaKernel ker(tau, h);
+  updateKernel(Z, res, der, grad, ker, n, n1);
+}
+
+// [[Rcpp::export]]
+void updateTrian(const arma::mat& Z, const arma::vec& res, arma::vec& der, arma::vec& grad, const int n, const double tau, const double h, 
+                 const double n1, const double h1, const double h2) {
+  TrianKernel ker(tau, h);
+  updateKernel(Z, res, der, grad, ker, n, n1);
+}
+
+// Functions with an upper bound for the GD step size.
+// [[Rcpp::export]]
+arma::vec huberReg(const arma::mat& Z, const arma::vec& Y, const double tau, arma::vec& der, arma::vec& gradOld, arma::vec& gradNew, const int n, const int p, 
+                   const double n1, const double tol = 0.0001, const double constTau = 1.345, const int iteMax = 5000, const double stepMax = 100.0) {
+  return huberDescent(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, BoundedStep(stepMax));
+}
+
+// Low-dimensional conquer: estimation
+// [[Rcpp::export]]
+Rcpp::List smqrGauss(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
+                     const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false) {
+  return smqrFit<GaussKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, BoundedStep(stepMax), single);
+}
+
+// [[Rcpp::export]]
+Rcpp::List smqrGaussNsd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
+                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+  return smqrFitNsd<GaussKernel>(Z, Y, tau, h, constTau, tol, iteMax, BoundedStep(stepMax));
+}
+
+// [[Rcpp::export]]
+arma::vec smqrGaussIni(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
+                       const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+  return smqrFitIni<GaussKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, BoundedStep(stepMax));
+}
+
+// [[Rcpp::export]]
+Rcpp::List smqrLogistic(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
+                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false) {
+  return smqrFit<LogisticKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, BoundedStep(stepMax), single);
+}
+
+// [[Rcpp::export]]
+Rcpp::List smqrLogisticNsd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
+                           const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+  return smqrFitNsd<LogisticKernel>(Z, Y, tau, h, constTau, tol, iteMax, BoundedStep(stepMax));
+}
+
+// [[Rcpp::export]]
+arma::vec smqrLogisticIni(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
+                          const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
+  return smqrFitIni<LogisticKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, BoundedStep(stepMax));
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrUnif(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                    const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+                    const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false) {
+  return smqrFit<UnifKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, BoundedStep(stepMax), single);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrUnifNsd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = Z.n_rows;
-  const int p = Z.n_cols - 1;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+  return smqrFitNsd<UnifKernel>(Z, Y, tau, h, constTau, tol, iteMax, BoundedStep(stepMax));
 }
 
 // [[Rcpp::export]]
 arma::vec smqrUnifIni(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
                       const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return beta;
+  return smqrFitIni<UnifKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, BoundedStep(stepMax));
 }
   
 // [[Rcpp::export]]
 Rcpp::List smqrPara(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                    const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h3 = 1.0 / (h * h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+                    const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false) {
+  return smqrFit<ParaKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, BoundedStep(stepMax), single);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrParaNsd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = Z.n_rows;
-  const int p = Z.n_cols - 1;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h3 = 1.0 / (h * h * h);
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+  return smqrFitNsd<ParaKernel>(Z, Y, tau, h, constTau, tol, iteMax, BoundedStep(stepMax));
 }
 
 // [[Rcpp::export]]
 arma::vec smqrParaIni(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
                       const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h3 = 1.0 / (h * h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return beta;
+  return smqrFitIni<ParaKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, BoundedStep(stepMax));
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrTrian(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                     const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h2 = 1.0 / (h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+                     const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false) {
+  return smqrFit<TrianKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, BoundedStep(stepMax), single);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrTrianNsd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
                         const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = Z.n_rows;
-  const int p = Z.n_cols - 1;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h2 = 1.0 / (h * h);
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+  return smqrFitNsd<TrianKernel>(Z, Y, tau, h, constTau, tol, iteMax, BoundedStep(stepMax));
 }
 
 // [[Rcpp::export]]
 arma::vec smqrTrianIni(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h2 = 1.0 / (h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(std::min(a1, a2), stepMax);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return beta;
-}
-
-// Global conquer process with a quantile grid
-// [[Rcpp::export]]
-Rcpp::List smqrGaussProc(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                         const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updateGauss(Z, res, der, gradOld, tau, n1, h1);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updateGauss(Z, res, der, gradNew, tau, n1, h1);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(std::min(a1, a2), stepMax);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updateGauss(Z, res, der, gradNew, tau, n1, h1);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+  return smqrFitIni<TrianKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, BoundedStep(stepMax));
+}
+
+// Global conquer process with a quantile grid
+// [[Rcpp::export]]
+Rcpp::List smqrGaussProc(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
+                         const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<GaussKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, BoundedStep(stepMax), single, parTau);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrLogisticProc(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                            const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updateLogistic(Z, res, der, gradOld, tau, n1, h1);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(std::min(a1, a2), stepMax);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+                            const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<LogisticKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, BoundedStep(stepMax), single, parTau);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrUnifProc(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(std::min(a1, a2), stepMax);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<UnifKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, BoundedStep(stepMax), single, parTau);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrParaProc(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h3 = 1.0 / (h * h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(std::min(a1, a2), stepMax);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+                        const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<ParaKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, BoundedStep(stepMax), single, parTau);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrTrianProc(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                         const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h2 = 1.0 / (h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberReg(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, stepMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(std::min(a1, a2), stepMax);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+                         const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<TrianKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, BoundedStep(stepMax), single, parTau);
 }
 
 // Conquer with bootstrap inference
 // [[Rcpp::export]]
-arma::mat smqrGaussInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                       const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrGaussIni(mbX, mbY, betaHat, p, tau, h, tol, iteMax, stepMax);
-  }
-  return rst;
+Rcpp::List smqrGaussInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                       const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, 
+                       const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                       const bool keep = false) {
+  return smqrFitInf<GaussKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, batch, newton, alpha, mcTol, keep);
 }
 
 // [[Rcpp::export]]
-arma::mat smqrLogisticInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                          const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrLogisticIni(mbX, mbY, betaHat, p, tau, h, tol, iteMax, stepMax);
-  }
-  return rst;
+Rcpp::List smqrLogisticInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                          const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, 
+                          const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                          const bool keep = false) {
+  return smqrFitInf<LogisticKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, batch, newton, alpha, mcTol, keep);
 }
 
 // [[Rcpp::export]]
-arma::mat smqrUnifInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                      const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrUnifIni(mbX, mbY, betaHat, p, tau, h, tol, iteMax, stepMax);
-  }
-  return rst;
+Rcpp::List smqrUnifInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                      const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, 
+                      const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                      const bool keep = false) {
+  return smqrFitInf<UnifKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, batch, newton, alpha, mcTol, keep);
 }
 
 // [[Rcpp::export]]
-arma::mat smqrParaInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                      const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrParaIni(mbX, mbY, betaHat, p, tau, h, tol, iteMax, stepMax);
-  }
-  return rst;
+Rcpp::List smqrParaInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                      const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, 
+                      const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                      const bool keep = false) {
+  return smqrFitInf<ParaKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, batch, newton, alpha, mcTol, keep);
 }
 
 // [[Rcpp::export]]
-arma::mat smqrTrianInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                       const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrTrianIni(mbX, mbY, betaHat, p, tau, h, tol, iteMax, stepMax);
-  }
-  return rst;
+Rcpp::List smqrTrianInf(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                       const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, 
+                       const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                       const bool keep = false) {
+  return smqrFitInf<TrianKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, batch, newton, alpha, mcTol, keep);
 }
 
+// Multiplier bootstrap bands of the conquer process
+// [[Rcpp::export]]
+Rcpp::List smqrGaussProcInf(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                            const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, const int seed = 0, 
+                            const double alpha = 0.05) {
+  return smqrFitProcInf<GaussKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, alpha);
+}
 
-// Functions without an upper bound for the step size
 // [[Rcpp::export]]
-arma::vec huberRegUbd(const arma::mat& Z, const arma::vec& Y, const double tau, arma::vec& der, arma::vec& gradOld, arma::vec& gradNew, const int n, const int p, 
-                      const double n1, const double tol = 0.0001, const double constTau = 1.345, const int iteMax = 5000) {
-  double rob = constTau * mad(Y);
-  updateHuber(Z, Y, tau, der, gradOld, n, rob, n1);
-  arma::vec beta = -gradOld, betaDiff = -gradOld;
-  arma::vec res = Y - Z * beta;
-  rob = constTau * mad(res);
-  updateHuber(Z, res, tau, der, gradNew, n, rob, n1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    rob = constTau * mad(res);
-    updateHuber(Z, res, tau, der, gradNew, n, rob, n1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  return beta;
+Rcpp::List smqrLogisticProcInf(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                               const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, const int seed = 0, 
+                               const double alpha = 0.05) {
+  return smqrFitProcInf<LogisticKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, alpha);
 }
 
-// Low-dimensional conquer: estimation
 // [[Rcpp::export]]
-Rcpp::List smqrGaussUbd(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                        const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateGauss(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateGauss(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateGauss(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+Rcpp::List smqrUnifProcInf(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                           const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, const int seed = 0, 
+                           const double alpha = 0.05) {
+  return smqrFitProcInf<UnifKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, alpha);
 }
 
 // [[Rcpp::export]]
-Rcpp::List smqrGaussNsdUbd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                           const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = Z.n_rows;
-  const int p = Z.n_cols - 1;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateGauss(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateGauss(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateGauss(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+Rcpp::List smqrParaProcInf(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                           const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, const int seed = 0, 
+                           const double alpha = 0.05) {
+  return smqrFitProcInf<ParaKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, alpha);
 }
 
 // [[Rcpp::export]]
-arma::vec smqrGaussIniUbd(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
-                          const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updateGauss(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateGauss(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateGauss(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return beta;
+Rcpp::List smqrTrianProcInf(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                            const double tol = 0.0001, const int iteMax = 5000, const double stepMax = 100.0, const int multiplier = 0, const int seed = 0, 
+                            const double alpha = 0.05) {
+  return smqrFitProcInf<TrianKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, BoundedStep(stepMax), multiplier, seed, alpha);
 }
 
+
+// Functions without an upper bound for the step size
 // [[Rcpp::export]]
-Rcpp::List smqrLogisticUbd(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                           const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateLogistic(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+arma::vec huberRegUbd(const arma::mat& Z, const arma::vec& Y, const double tau, arma::vec& der, arma::vec& gradOld, arma::vec& gradNew, const int n, const int p, 
+                      const double n1, const double tol = 0.0001, const double constTau = 1.345, const int iteMax = 5000) {
+  return huberDescent(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax, UnboundedStep());
+}
+
+// Low-dimensional conquer: estimation
+// [[Rcpp::export]]
+Rcpp::List smqrGaussUbd(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
+                        const double tol = 0.0001, const int iteMax = 5000, const bool single = false) {
+  return smqrFit<GaussKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, UnboundedStep(), single);
+}
+
+// [[Rcpp::export]]
+Rcpp::List smqrGaussNsdUbd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
+                           const double tol = 0.0001, const int iteMax = 5000) {
+  return smqrFitNsd<GaussKernel>(Z, Y, tau, h, constTau, tol, iteMax, UnboundedStep());
+}
+
+// [[Rcpp::export]]
+arma::vec smqrGaussIniUbd(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
+                          const double tol = 0.0001, const int iteMax = 5000) {
+  return smqrFitIni<GaussKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, UnboundedStep());
+}
+
+// [[Rcpp::export]]
+Rcpp::List smqrLogisticUbd(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
+                           const double tol = 0.0001, const int iteMax = 5000, const bool single = false) {
+  return smqrFit<LogisticKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, UnboundedStep(), single);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrLogisticNsdUbd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
                               const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = Z.n_rows;
-  const int p = Z.n_cols - 1;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateLogistic(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+  return smqrFitNsd<LogisticKernel>(Z, Y, tau, h, constTau, tol, iteMax, UnboundedStep());
 }
 
 // [[Rcpp::export]]
 arma::vec smqrLogisticIniUbd(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
                              const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updateLogistic(Z, res, der, gradOld, tau, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return beta;
+  return smqrFitIni<LogisticKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, UnboundedStep());
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrUnifUbd(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                       const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+                       const double tol = 0.0001, const int iteMax = 5000, const bool single = false) {
+  return smqrFit<UnifKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, UnboundedStep(), single);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrUnifNsdUbd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
                           const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = Z.n_rows;
-  const int p = Z.n_cols - 1;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+  return smqrFitNsd<UnifKernel>(Z, Y, tau, h, constTau, tol, iteMax, UnboundedStep());
 }
 
 // [[Rcpp::export]]
 arma::vec smqrUnifIniUbd(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
                          const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateUnif(Z, res, der, gradNew, n, tau, h, n1, h1);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return beta;
+  return smqrFitIni<UnifKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, UnboundedStep());
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrParaUbd(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                       const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h3 = 1.0 / (h * h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
-}
-
-// [[Rcpp::export]]
-Rcpp::List smqrParaNsdUbd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                          const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = Z.n_rows;
-  const int p = Z.n_cols - 1;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h3 = 1.0 / (h * h * h);
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+                       const double tol = 0.0001, const int iteMax = 5000, const bool single = false) {
+  return smqrFit<ParaKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, UnboundedStep(), single);
 }
 
 // [[Rcpp::export]]
-arma::vec smqrParaIniUbd(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
-                         const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h3 = 1.0 / (h * h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updatePara(Z, res, der, gradNew, n, tau, h, n1, h1, h3);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return beta;
+Rcpp::List smqrParaNsdUbd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
+                          const double tol = 0.0001, const int iteMax = 5000) {
+  return smqrFitNsd<ParaKernel>(Z, Y, tau, h, constTau, tol, iteMax, UnboundedStep());
+}
+
+// [[Rcpp::export]]
+arma::vec smqrParaIniUbd(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
+                         const double tol = 0.0001, const int iteMax = 5000) {
+  return smqrFitIni<ParaKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, UnboundedStep());
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrTrianUbd(const arma::mat& X, arma::vec Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
-                        const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h2 = 1.0 / (h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+                        const double tol = 0.0001, const int iteMax = 5000, const bool single = false) {
+  return smqrFit<TrianKernel>(X, std::move(Y), tau, h, constTau, tol, iteMax, UnboundedStep(), single);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrTrianNsdUbd(const arma::mat& Z, const arma::vec& Y, const double tau = 0.5, double h = 0.05, const double constTau = 1.345, 
                            const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = Z.n_rows;
-  const int p = Z.n_cols - 1;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h2 = 1.0 / (h * h);
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-  arma::vec quant = {tau};
-  beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-  arma::vec res = Y - Z * beta;
-  updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  return Rcpp::List::create(Rcpp::Named("coeff") = beta, Rcpp::Named("ite") = ite, Rcpp::Named("residual") = res, Rcpp::Named("bandwidth") = h);
+  return smqrFitNsd<TrianKernel>(Z, Y, tau, h, constTau, tol, iteMax, UnboundedStep());
 }
 
 // [[Rcpp::export]]
 arma::vec smqrTrianIniUbd(const arma::mat& X, arma::vec Y, const arma::vec& betaHat, const int p, const double tau = 0.5, double h = 0.05,
                           const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h2 = 1.0 / (h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::vec beta = betaHat;
-  arma::vec res = Y - Z * beta;
-  updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-  beta -= gradOld;
-  arma::vec betaDiff = -gradOld;
-  res -= Z * betaDiff;
-  updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-  arma::vec gradDiff = gradNew - gradOld;
-  int ite = 1;
-  while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-    double alpha = 1.0;
-    double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-    if (cross > 0) {
-      double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-      double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-      alpha = std::min(a1, a2);
-    }
-    gradOld = gradNew;
-    betaDiff = -alpha * gradNew;
-    beta += betaDiff;
-    res -= Z * betaDiff;
-    updateTrian(Z, res, der, gradNew, n, tau, h, n1, h1, h2);
-    gradDiff = gradNew - gradOld;
-    ite++;
-  }
-  beta.rows(1, p) %= sx1;
-  beta(0) += my - arma::as_scalar(mx * beta.rows(1, p));
-  return beta;
+  return smqrFitIni<TrianKernel>(X, std::move(Y), betaHat, p, tau, h, tol, iteMax, UnboundedStep());
 }
 
 // Global conquer process with a quantile grid
 // [[Rcpp::export]]
 Rcpp::List smqrGaussProcUbd(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                            const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updateGauss(Z, res, der, gradOld, tau, n1, h1);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updateGauss(Z, res, der, gradNew, tau, n1, h1);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(a1, a2);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updateGauss(Z, res, der, gradNew, tau, n1, h1);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+                            const double tol = 0.0001, const int iteMax = 5000, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<GaussKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, UnboundedStep(), single, parTau);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrLogisticProcUbd(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                               const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updateLogistic(Z, res, der, gradOld, tau, n1, h1);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(a1, a2);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updateLogistic(Z, res, der, gradNew, tau, n1, h1);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+                               const double tol = 0.0001, const int iteMax = 5000, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<LogisticKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, UnboundedStep(), single, parTau);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrUnifProcUbd(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                           const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h;
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(a1, a2);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updateUnif(Z, res, der, gradOld, n, tau, h, n1, h1);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+                           const double tol = 0.0001, const int iteMax = 5000, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<UnifKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, UnboundedStep(), single, parTau);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrParaProcUbd(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                           const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h3 = 1.0 / (h * h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(a1, a2);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updatePara(Z, res, der, gradOld, n, tau, h, n1, h1, h3);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+                           const double tol = 0.0001, const int iteMax = 5000, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<ParaKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, UnboundedStep(), single, parTau);
 }
 
 // [[Rcpp::export]]
 Rcpp::List smqrTrianProcUbd(const arma::mat& X, arma::vec Y, const arma::vec tauSeq, double h = 0.05, const double constTau = 1.345, 
-                            const double tol = 0.0001, const int iteMax = 5000) {
-  const int n = X.n_rows;
-  const int p = X.n_cols;
-  const int m = tauSeq.size();
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  const double n1 = 1.0 / n;
-  const double h1 = 1.0 / h, h2 = 1.0 / (h * h);
-  arma::rowvec mx = arma::mean(X, 0);
-  arma::vec sx1 = 1.0 / arma::stddev(X, 0, 0).t();
-  arma::mat Z = arma::join_rows(arma::ones(n), standardize(X, mx, sx1, p));
-  double my = arma::mean(Y);
-  Y -= my;
-  arma::vec der(n);
-  arma::vec gradOld(p + 1), gradNew(p + 1);
-  arma::mat betaProc(p + 1, m);
-  for (int i = 0; i < m; i++) {
-    double tau = tauSeq(i);
-    arma::vec beta = huberRegUbd(Z, Y, tau, der, gradOld, gradNew, n, p, n1, tol, constTau, iteMax);
-    arma::vec quant = {tau};
-    beta(0) = arma::as_scalar(arma::quantile(Y - Z.cols(1, p) * beta.rows(1, p), quant));
-    arma::vec res = Y - Z * beta;
-    updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-    beta -= gradOld;
-    arma::vec betaDiff = -gradOld;
-    res -= Z * betaDiff;
-    updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-    arma::vec gradDiff = gradNew - gradOld;
-    int ite = 1;
-    while (arma::norm(gradNew, "inf") > tol && ite <= iteMax) {
-      double alpha = 1.0;
-      double cross = arma::as_scalar(betaDiff.t() * gradDiff);
-      if (cross > 0) {
-        double a1 = cross / arma::as_scalar(gradDiff.t() * gradDiff);
-        double a2 = arma::as_scalar(betaDiff.t() * betaDiff) / cross;
-        alpha = std::min(a1, a2);
-      }
-      gradOld = gradNew;
-      betaDiff = -alpha * gradNew;
-      beta += betaDiff;
-      res -= Z * betaDiff;
-      updateTrian(Z, res, der, gradOld, n, tau, h, n1, h1, h2);
-      gradDiff = gradNew - gradOld;
-      ite++;
-    }
-    betaProc.col(i) = beta;
-  }
-  betaProc.rows(1, p).each_col() %= sx1;
-  betaProc.row(0) += my - mx * betaProc.rows(1, p);
-  return Rcpp::List::create(Rcpp::Named("coeff") = betaProc, Rcpp::Named("bandwidth") = h);
+                            const double tol = 0.0001, const int iteMax = 5000, const bool single = false, const bool parTau = false) {
+  return smqrFitProc<TrianKernel>(X, std::move(Y), tauSeq, h, constTau, tol, iteMax, UnboundedStep(), single, parTau);
 }
 
 // Conquer with bootstrap inference
 // [[Rcpp::export]]
-arma::mat smqrGaussInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                          const int B = 1000, const double tol = 0.0001, const int iteMax = 5000) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrGaussIniUbd(mbX, mbY, betaHat, p, tau, h, tol, iteMax);
-  }
-  return rst;
+Rcpp::List smqrGaussInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                          const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, 
+                          const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                          const bool keep = false) {
+  return smqrFitInf<GaussKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, UnboundedStep(), multiplier, seed, batch, newton, alpha, mcTol, keep);
 }
 
 // [[Rcpp::export]]
-arma::mat smqrLogisticInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                             const int B = 1000, const double tol = 0.0001, const int iteMax = 5000) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrLogisticIniUbd(mbX, mbY, betaHat, p, tau, h, tol, iteMax);
-  }
-  return rst;
+Rcpp::List smqrLogisticInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                             const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, 
+                             const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                             const bool keep = false) {
+  return smqrFitInf<LogisticKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, UnboundedStep(), multiplier, seed, batch, newton, alpha, mcTol, keep);
 }
 
 // [[Rcpp::export]]
-arma::mat smqrUnifInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                         const int B = 1000, const double tol = 0.0001, const int iteMax = 5000) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrUnifIniUbd(mbX, mbY, betaHat, p, tau, h, tol, iteMax);
-  }
-  return rst;
+Rcpp::List smqrUnifInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                         const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, 
+                         const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                         const bool keep = false) {
+  return smqrFitInf<UnifKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, UnboundedStep(), multiplier, seed, batch, newton, alpha, mcTol, keep);
 }
 
 // [[Rcpp::export]]
-arma::mat smqrParaInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                         const int B = 1000, const double tol = 0.0001, const int iteMax = 5000) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
-  }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrParaIniUbd(mbX, mbY, betaHat, p, tau, h, tol, iteMax);
-  }
-  return rst;
+Rcpp::List smqrParaInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                         const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, 
+                         const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                         const bool keep = false) {
+  return smqrFitInf<ParaKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, UnboundedStep(), multiplier, seed, batch, newton, alpha, mcTol, keep);
 }
 
 // [[Rcpp::export]]
-arma::mat smqrTrianInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
-                          const int B = 1000, const double tol = 0.0001, const int iteMax = 5000) {
-  arma::mat rst(p + 1, B);
-  if (h <= 0.0) {
-    h = std::max(std::pow((std::log(n) + p) / n, 0.4), 0.05);
+Rcpp::List smqrTrianInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& betaHat, const int n, const int p, double h = 0.05, const double tau = 0.5, 
+                          const int B = 1000, const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, 
+                          const int seed = 0, const int batch = 0, const int newton = 0, const double alpha = 0.05, const double mcTol = 0.0, 
+                          const bool keep = false) {
+  return smqrFitInf<TrianKernel>(X, Y, betaHat, n, p, h, tau, B, tol, iteMax, UnboundedStep(), multiplier, seed, batch, newton, alpha, mcTol, keep);
+}
+
+// Multiplier bootstrap bands of the conquer process
+// [[Rcpp::export]]
+Rcpp::List smqrGaussProcInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                               const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, const int seed = 0, const double alpha = 0.05) {
+  return smqrFitProcInf<GaussKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, UnboundedStep(), multiplier, seed, alpha);
+}
+
+// [[Rcpp::export]]
+Rcpp::List smqrLogisticProcInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                                  const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, const int seed = 0, const double alpha = 0.05) {
+  return smqrFitProcInf<LogisticKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, UnboundedStep(), multiplier, seed, alpha);
+}
+
+// [[Rcpp::export]]
+Rcpp::List smqrUnifProcInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                              const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, const int seed = 0, const double alpha = 0.05) {
+  return smqrFitProcInf<UnifKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, UnboundedStep(), multiplier, seed, alpha);
+}
+
+// [[Rcpp::export]]
+Rcpp::List smqrParaProcInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                              const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, const int seed = 0, const double alpha = 0.05) {
+  return smqrFitProcInf<ParaKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, UnboundedStep(), multiplier, seed, alpha);
+}
+
+// [[Rcpp::export]]
+Rcpp::List smqrTrianProcInfUbd(const arma::mat& X, const arma::vec& Y, const arma::vec& tauSeq, const arma::mat& betaProc, double h = 0.05, const int B = 1000, 
+                               const double tol = 0.0001, const int iteMax = 5000, const int multiplier = 0, const int seed = 0, const double alpha = 0.05) {
+  return smqrFitProcInf<TrianKernel>(X, Y, tauSeq, betaProc, h, B, tol, iteMax, UnboundedStep(), multiplier, seed, alpha);
+}
+
+// Scores summed within clusters, U(g, j) = sum_{i in g} der_i z_ij on the unstandardized design (1, X), with cluster ids coded 1, ..., G.
+// Each column of X is streamed once and scattered into its own column of U, so the threads split the columns and U is never copied.
+arma::mat clusterScores(const arma::mat& X, const arma::vec& der, const arma::ivec& cluster, const int G) {
+  const int n = X.n_rows, p = X.n_cols;
+  if ((int)cluster.n_elem != n) {
+    Rcpp::stop("the length of cluster must be the number of rows of X");
+  }
+  if (cluster.min() < 1 || cluster.max() > G) {
+    Rcpp::stop("the cluster ids must be coded 1, ..., G");
+  }
+  arma::mat U(G, p + 1, arma::fill::zeros);
+  const int nt = std::min(passThreads(n), p + 1);
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int j = 0; j <= p; j++) {
+    double* uj = U.colptr(j);
+    if (j == 0) {
+      for (int i = 0; i < n; i++) {
+        uj[cluster(i) - 1] += der(i);
+      }
+    } else {
+      const double* xj = X.colptr(j - 1);
+      for (int i = 0; i < n; i++) {
+        uj[cluster(i) - 1] += der(i) * xj[i];
+      }
+    }
+  }
+  return U;
+}
+
+// Sandwich covariance Dh^{-1} * Stau * Dh^{-1} of the conquer estimate on the unstandardized design (1, X), with Stau = sum_i der(r_i)^2 z_i z_i^T
+// and Dh = sum_i hess(r_i) z_i z_i^T for the kernel that was fitted. The residuals of the fit are reused, both matrices are accumulated in the
+// same pass over X, and Dh is inverted through its Cholesky factor. If cluster is not empty, Stau is the cluster-robust G / (G - 1) * U^T U
+// from the per-cluster score sums U, which costs one more pass over X and G (p + 1)^2 for the crossproduct, while Dh is unchanged.
+template <typename Kernel>
+arma::mat smqrCovariance(const arma::mat& X, const arma::vec& res, const double tau, const double h, const arma::ivec& cluster) {
+  const int n = X.n_rows;
+  const int p = X.n_cols;
+  Kernel ker(tau, h);
+  const StdDesign<double> Z(X, arma::zeros<arma::rowvec>(p), arma::ones(p));
+  arma::mat Q(n, 2);
+  ker.der(res.memptr(), Q.colptr(0), n);
+  arma::mat S, D;
+  if (cluster.n_elem == 0) {
+    for (int i = 0; i < n; i++) {
+      Q(i, 0) *= Q(i, 0);
+      Q(i, 1) = ker.hess(res(i));
+    }
+    arma::cube H;
+    weightedGram(Z, Q, H);
+    S = H.slice(0);
+    D = H.slice(1);
+  } else {
+    for (int i = 0; i < n; i++) {
+      Q(i, 1) = ker.hess(res(i));
+    }
+    weightedGram(Z, Q.unsafe_col(1), D);
+    const int G = cluster.max();
+    const arma::mat U = clusterScores(X, Q.unsafe_col(0), cluster, G);
+    S = U.t() * U;
+    if (G > 1) {
+      S *= G / (G - 1.0);
+    }
   }
-  for (int b = 0; b < B; b++) {
-    arma::uvec idx = arma::find(arma::randi(n, arma::distr_param(0, 1)) == 1);
-    arma::mat mbX = X.rows(idx);
-    arma::mat mbY = Y.rows(idx);
-    rst.col(b) = smqrTrianIniUbd(mbX, mbY, betaHat, p, tau, h, tol, iteMax);
+  arma::mat R;
+  if (!arma::chol(R, D)) {
+    Rcpp::stop("the smoothed hessian is singular");
   }
-  return rst;
+  arma::mat Rinv = arma::inv(arma::trimatu(R));
+  arma::mat A = Rinv.t() * S * Rinv;
+  return Rinv * A * Rinv.t();
 }
 
-// Inference based on asymptotic distribution
-// [[Rcpp::export]]
-arma::mat asymptoticCI(const arma::mat& X, const arma::vec& res, const arma::vec& coeff, const double tau, 
-                       const int n, const double h, const double z) {
-  arma::mat Z = arma::join_rows(arma::ones(n), X);
-  arma::vec Wh = arma::square(arma::normcdf(-res / h) - tau);
-  arma::vec Wh2 = arma::normpdf(res / h) / h;
-  arma::mat temp = Z;
-  for (int i = 0; i < n; i++) {
-    temp.row(i) = Wh.row(i) * Z.row(i);
+// Joint sandwich covariance of the conquer process at the levels tauSeq on the unstandardized design (1, X), with the coefficients stacked level
+// by level. The (k, l) block is Dk^{-1} * Skl * Dl^{-1}, with Skl = sum_i der_k(r_ik) der_l(r_il) z_i z_i^T and Dk = sum_i hess_k(r_ik) z_i z_i^T.
+// Everything comes from one pass over X in row panels: the residuals of all levels are one small GEMM per panel, the scores of all levels are
+// laid side by side into a panel of width (p + 1) * m whose crossproduct adds every Skl at once, and each Dk is a rank-k update of the panel
+// scaled by sqrt(hess_k). No n by p array is formed for any level. The panels are visited in order and the threads split each one by level:
+// level k fills its scores and Dk, then column block l of S is updated by one thread, so a single copy of S is kept for any number of threads.
+template <typename Kernel>
+arma::mat smqrProcCovariance(const arma::mat& X, const arma::vec& Y, const arma::mat& betaProc, const arma::vec& tauSeq, const double h) {
+  const int n = X.n_rows, p = X.n_cols, m = tauSeq.n_elem, d = p + 1;
+  std::vector<Kernel> ker;
+  for (int k = 0; k < m; k++) {
+    ker.emplace_back(tauSeq(k), h);
+  }
+  const int rows = std::max(64, 32768 / (d * m));
+  const int nt = std::min(passThreads(n), m);
+  arma::mat S(d * m, d * m, arma::fill::zeros);
+  arma::cube D(d, d, m, arma::fill::zeros);
+  arma::mat A, R, W;
+  #pragma omp parallel num_threads(nt)
+  {
+    arma::mat As;
+    arma::vec g, q;
+    for (int i0 = 0; i0 < n; i0 += rows) {
+      const int r = std::min(n, i0 + rows) - i0;
+      #pragma omp single
+      {
+        A.set_size(r, d);
+        A.col(0).ones();
+        A.tail_cols(p) = X.rows(i0, i0 + r - 1);
+        R = A * betaProc;
+        W.set_size(r, d * m);
+      }
+      g.set_size(r);
+      q.set_size(r);
+      #pragma omp for schedule(static)
+      for (int k = 0; k < m; k++) {
+        double* rk = R.colptr(k);
+        for (int i = 0; i < r; i++) {
+          rk[i] = Y(i0 + i) - rk[i];
+        }
+        ker[k].der(rk, g.memptr(), r);
+        for (int i = 0; i < r; i++) {
+          q(i) = std::sqrt(ker[k].hess(rk[i]));
+        }
+        W.cols(k * d, k * d + p) = A.each_col() % g;
+        As = A.each_col() % q;
+        D.slice(k) += As.t() * As;
+      }
+      #pragma omp for schedule(static)
+      for (int l = 0; l < m; l++) {
+        S.cols(l * d, l * d + p) += W.t() * W.cols(l * d, l * d + p);
+      }
+    }
   }
-  arma::mat Stau = temp.t() * Z;
-  for (int i = 0; i < n; i++) {
-    temp.row(i) = Wh2.row(i) * Z.row(i);
+  arma::mat Rk;
+  for (int k = 0; k < m; k++) {
+    if (!arma::chol(Rk, D.slice(k))) {
+      Rcpp::stop("the smoothed hessian is singular");
+    }
+    arma::mat Rinv = arma::inv(arma::trimatu(Rk));
+    const arma::mat Dinv = Rinv * Rinv.t();
+    S.rows(k * d, k * d + p) = Dinv * S.rows(k * d, k * d + p);
+    S.cols(k * d, k * d + p) = S.cols(k * d, k * d + p) * Dinv;
   }
-  arma::mat Dh = temp.t() * Z;
-  arma::mat Dhinv = Dh.i();
-  arma::vec tm = z * arma::sqrt(arma::diagvec(Dhinv * Stau * Dhinv));
+  return arma::symmatu(S);
+}
+
+// Inference based on asymptotic distribution, with kernel = 0, ..., 4 for the Gaussian, logistic, uniform, parabolic and triangular kernels.
+// cluster holds cluster ids coded 1, ..., G for the cluster-robust covariance, or is empty for independent observations.
+// [[Rcpp::export]]
+arma::mat asymptoticCI(const arma::mat& X, const arma::vec& res, const arma::vec& coeff, const double tau, const double h, const double z,
+                       const arma::ivec& cluster, const int kernel = 0) {
+  arma::mat cov;
+  switch (kernel) {
+    case 1:
+      cov = smqrCovariance<LogisticKernel>(X, res, tau, h, cluster);
+      break;
+    case 2:
+      cov = smqrCovariance<UnifKernel>(X, res, tau, h, cluster);
+      break;
+    case 3:
+      cov = smqrCovariance<ParaKernel>(X, res, tau, h, cluster);
+      break;
+    case 4:
+      cov = smqrCovariance<TrianKernel>(X, res, tau, h, cluster);
+      break;
+    default:
+      cov = smqrCovariance<GaussKernel>(X, res, tau, h, cluster);
+  }
+  arma::vec tm = z * arma::sqrt(cov.diag());
   return arma::join_rows(coeff - tm, coeff + tm);
 }
+
+// Joint asymptotic covariance of the conquer process, with kernel coded as in asymptoticCI. If contrast has columns, contrast * cov * contrast^T
+// is returned instead of the full (p + 1) * m by (p + 1) * m matrix.
+// [[Rcpp::export]]
+arma::mat processCovariance(const arma::mat& X, const arma::vec& Y, const arma::mat& betaProc, const arma::vec& tauSeq, const double h,
+                            const arma::mat& contrast, const int kernel = 0) {
+  arma::mat cov;
+  switch (kernel) {
+    case 1:
+      cov = smqrProcCovariance<LogisticKernel>(X, Y, betaProc, tauSeq, h);
+      break;
+    case 2:
+      cov = smqrProcCovariance<UnifKernel>(X, Y, betaProc, tauSeq, h);
+      break;
+    case 3:
+      cov = smqrProcCovariance<ParaKernel>(X, Y, betaProc, tauSeq, h);
+      break;
+    case 4:
+      cov = smqrProcCovariance<TrianKernel>(X, Y, betaProc, tauSeq, h);
+      break;
+    default:
+      cov = smqrProcCovariance<GaussKernel>(X, Y, betaProc, tauSeq, h);
+  }
+  if (contrast.n_cols == 0) {
+    return cov;
+  }
+  return contrast * cov * contrast.t();
+}
@@ -0,0 +1,23 @@
+# include <RcppArmadillo.h>
+# include "parallel.h"
+// [[Rcpp::depends(RcppArmadillo)]]
+// [[Rcpp::plugins(cpp11)]]
+
+static int numThreads = 1;
+
+int conquerThreads() {
+  return numThreads;
+}
+
+// Sets the number of threads of the parallel passes and returns the previous value, so that the R functions can restore it on exit. A value
+// of 0 or less uses every available core. Without OpenMP the passes always run on one thread.
+// [[Rcpp::export]]
+int setThreads(const int nthreads) {
+  const int old = numThreads;
+#ifdef _OPENMP
+  numThreads = nthreads > 0 ? nthreads : omp_get_num_procs();
+#else
+  numThreads = 1;
+#endif
+  return old;
+}
@@ -0,0 +1,184 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+# include <RcppArmadillo.h>
+# include <algorithm>
+# include <type_traits>
+# include <vector>
+# ifdef _OPENMP
+#  include <omp.h>
+# endif
+// [[Rcpp::depends(RcppArmadillo)]]
+// [[Rcpp::plugins(cpp11)]]
+
+// Row-partitioned passes over the design shared by all solvers. Each thread owns one contiguous block of rows, partial sums are kept per
+// thread and added up in thread order, so for a fixed number of threads the result does not depend on scheduling. With one thread and a
+// double precision design the passes fall back to the BLAS products used before. A single precision design is read as float and every
+// product is accumulated in double.
+
+// Number of threads of the parallel passes, 1 unless changed through setThreads()
+int conquerThreads();
+
+int setThreads(const int nthreads);
+
+// Blocks below this many rows are not worth waking up a thread for
+const int minBlockRows = 2048;
+
+// Passes started from inside a parallel region, e.g. one fit per thread, run on the calling thread
+inline int passThreads(const int n) {
+# ifdef _OPENMP
+  if (omp_in_parallel()) {
+    return 1;
+  }
+# endif
+  return std::max(1, std::min(conquerThreads(), n / minBlockRows));
+}
+
+inline int blockBegin(const int n, const int t, const int nt) {
+  return (int)((long long)n * t / nt);
+}
+
+// Sum over the row blocks of f(i0, i1), one block per thread
+template <typename F>
+double blockSum(const int n, const F& f) {
+  const int nt = passThreads(n);
+  if (nt == 1) {
+    return f(0, n);
+  }
+  std::vector<double> part(nt);
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int t = 0; t < nt; t++) {
+    part[t] = f(blockBegin(n, t, nt), blockBegin(n, t + 1, nt));
+  }
+  double rst = 0.0;
+  for (int t = 0; t < nt; t++) {
+    rst += part[t];
+  }
+  return rst;
+}
+
+// res -= Z * v. Only the columns with a nonzero coefficient are read, so for a sparse v, e.g. a penalized fit or the change made by one of its
+// steps, the pass costs O(n * nnz(v)) instead of O(n * d). A mostly dense v on one thread in double precision goes to the BLAS product.
+template <typename eT>
+void matvecSub(const arma::Mat<eT>& Z, const arma::vec& v, arma::vec& res) {
+  const int n = Z.n_rows, d = Z.n_cols;
+  const arma::uvec active = arma::find(v);
+  const int na = active.n_elem;
+  const int nt = passThreads(n);
+  if constexpr (std::is_same<eT, double>::value) {
+    if (nt == 1 && 4 * na >= d) {
+      res -= Z * v;
+      return;
+    }
+  }
+  if (na == 0) {
+    return;
+  }
+  const double* b = v.memptr();
+  const arma::uword* act = active.memptr();
+  double* r = res.memptr();
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int t = 0; t < nt; t++) {
+    const int i0 = blockBegin(n, t, nt), i1 = blockBegin(n, t + 1, nt);
+    for (int k = 0; k < na; k++) {
+      const eT* zj = Z.colptr(act[k]);
+      const double bj = b[act[k]];
+      for (int i = i0; i < i1; i++) {
+        r[i] -= zj[i] * bj;
+      }
+    }
+  }
+}
+
+// res = Y - Z * beta
+template <typename eT>
+void residual(const arma::Mat<eT>& Z, const arma::vec& Y, const arma::vec& beta, arma::vec& res) {
+  res = Y;
+  matvecSub(Z, beta, res);
+}
+
+// grad = n1 * Z^T der. Wide designs split the columns between threads, tall and narrow ones split the rows and add up per-thread partial
+// gradients.
+template <typename eT>
+void gradient(const arma::Mat<eT>& Z, const arma::vec& der, arma::vec& grad, const double n1) {
+  const int n = Z.n_rows, d = Z.n_cols;
+  const int nt = passThreads(n);
+  if constexpr (std::is_same<eT, double>::value) {
+    if (nt == 1) {
+      grad = n1 * Z.t() * der;
+      return;
+    }
+  }
+  grad.set_size(d);
+  const double* dr = der.memptr();
+  double* g = grad.memptr();
+  if (d >= 8 * nt) {
+    #pragma omp parallel for num_threads(nt) schedule(static)
+    for (int j = 0; j < d; j++) {
+      const eT* zj = Z.colptr(j);
+      double s = 0.0;
+      for (int i = 0; i < n; i++) {
+        s += zj[i] * dr[i];
+      }
+      g[j] = n1 * s;
+    }
+    return;
+  }
+  arma::mat part(d, nt);
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int t = 0; t < nt; t++) {
+    const int i0 = blockBegin(n, t, nt), i1 = blockBegin(n, t + 1, nt);
+    double* pt = part.colptr(t);
+    for (int j = 0; j < d; j++) {
+      const eT* zj = Z.colptr(j);
+      double s = 0.0;
+      for (int i = i0; i < i1; i++) {
+        s += zj[i] * dr[i];
+      }
+      pt[j] = s;
+    }
+  }
+  grad = n1 * arma::sum(part, 1);
+}
+
+// grad = n1 * Z^T der on the columns listed in cols and zero on the others, for a solver restricted to a working set
+template <typename eT>
+void gradient(const arma::Mat<eT>& Z, const arma::vec& der, arma::vec& grad, const double n1, const arma::uvec& cols) {
+  const int n = Z.n_rows, nc = cols.n_elem;
+  const int nt = passThreads(n);
+  grad.zeros(Z.n_cols);
+  const double* dr = der.memptr();
+  const arma::uword* cl = cols.memptr();
+  double* g = grad.memptr();
+  if (nt == 1 || nc >= 8 * nt) {
+    #pragma omp parallel for num_threads(nt) schedule(static)
+    for (int k = 0; k < nc; k++) {
+      const eT* zj = Z.colptr(cl[k]);
+      double s = 0.0;
+      for (int i = 0; i < n; i++) {
+        s += zj[i] * dr[i];
+      }
+      g[cl[k]] = n1 * s;
+    }
+    return;
+  }
+  arma::mat part(nc, nt);
+  #pragma omp parallel for num_threads(nt) schedule(static)
+  for (int t = 0; t < nt; t++) {
+    const int i0 = blockBegin(n, t, nt), i1 = blockBegin(n, t + 1, nt);
+    double* pt = part.colptr(t);
+    for (int k = 0; k < nc; k++) {
+      const eT* zj = Z.colptr(cl[k]);
+      double s = 0.0;
+      for (int i = i0; i < i1; i++) {
+        s += zj[i] * dr[i];
+      }
+      pt[k] = s;
+    }
+  }
+  for (int k = 0; k < nc; k++) {
+    g[cl[k]] = n1 * arma::accu(part.row(k));
+  }
+}
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef RNG_H
+#define RNG_H
+
+# include <cmath>
+# include <cstdint>
+
+// Counter-based random numbers. The k-th draw of a stream is a hash of (seed, stream, k), so every bootstrap replicate owns an independent
+// stream that does not depend on the order in which replicates are run or on the thread running them. The hash is the splitmix64 finalizer
+// applied to a Weyl sequence.
+inline uint64_t mix64(uint64_t z) {
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+struct CounterRng {
+  static const uint64_t gamma = 0x9e3779b97f4a7c15ULL;
+  uint64_t key;
+  CounterRng(const uint64_t seed, const uint64_t stream) : key(mix64(mix64(seed) + gamma * (stream + 1))) {}
+  // Uniform on the open interval (0, 1)
+  double uniform(const uint64_t k) const {
+    return ((mix64(key + gamma * k) >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+  }
+  // Standard normal by Box-Muller from the draws 2k and 2k + 1
+  double normal(const uint64_t k) const {
+    return std::sqrt(-2.0 * std::log(uniform(2 * k))) * std::cos(6.283185307179586 * uniform(2 * k + 1));
+  }
+};
+
+#endif
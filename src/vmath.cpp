@@ -0,0 +1,119 @@
+# include "vmath.h"
+
+CONQUER_TARGET_CLONES
+void gaussDer(const double* res, double* der, const int n, const double tau, const double h1) {
+  #pragma omp simd
+  for (int i = 0; i < n; i++) {
+    der[i] = vnormcdf(-h1 * res[i]) - tau;
+  }
+}
+
+CONQUER_TARGET_CLONES
+void logisticDer(const double* res, double* der, const int n, const double tau, const double h1) {
+  #pragma omp simd
+  for (int i = 0; i < n; i++) {
+    der[i] = vlogistic(h1 * res[i]) - tau;
+  }
+}
+
+// The loss is h * phi(res / h) + res * (tau - Phi(-res / h)), which shares Phi with the derivative
+CONQUER_TARGET_CLONES
+double gaussLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1, const double h2) {
+  double rst = 0.0;
+  if (der == NULL) {
+    #pragma omp simd reduction(+:rst)
+    for (int i = 0; i < n; i++) {
+      const double cur = res[i];
+      rst += 0.3989423 * h * vexp(-0.5 * h2 * cur * cur) + cur * (tau - vnormcdf(-h1 * cur));
+    }
+    return rst;
+  }
+  #pragma omp simd reduction(+:rst)
+  for (int i = 0; i < n; i++) {
+    const double cur = res[i];
+    const double cdf = vnormcdf(-h1 * cur);
+    der[i] = cdf - tau;
+    rst += 0.3989423 * h * vexp(-0.5 * h2 * cur * cur) + cur * (tau - cdf);
+  }
+  return rst;
+}
+
+// The loss is tau * res + h * log(1 + exp(-res / h)), both it and the derivative come from one exp(-|res| / h)
+CONQUER_TARGET_CLONES
+double logisticLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1) {
+  double rst = 0.0;
+  if (der == NULL) {
+    #pragma omp simd reduction(+:rst)
+    for (int i = 0; i < n; i++) {
+      const double cur = res[i];
+      rst += tau * cur + h * vsoftplus(-h1 * cur);
+    }
+    return rst;
+  }
+  #pragma omp simd reduction(+:rst)
+  for (int i = 0; i < n; i++) {
+    const double cur = res[i], u = h1 * cur;
+    const double e = vexp(-std::abs(u));
+    der[i] = blend(u > 0, e, 1.0) / (1.0 + e) - tau;
+    rst += tau * cur + h * (blend(u < 0, -u, 0.0) + log1pUnit(e));
+  }
+  return rst;
+}
+
+template <typename Poly>
+CONQUER_INLINE void compactDer(const double* res, double* der, const int n, const double tau, const double h1) {
+  #pragma omp simd
+  for (int i = 0; i < n; i++) {
+    der[i] = 0.5 - tau - Poly::der(clampUnit(h1 * res[i]));
+  }
+}
+
+template <typename Poly>
+CONQUER_INLINE double compactLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1) {
+  double rst = 0.0;
+  if (der == NULL) {
+    #pragma omp simd reduction(+:rst)
+    for (int i = 0; i < n; i++) {
+      const double cur = res[i], a = std::abs(clampUnit(h1 * cur));
+      rst += (tau - 0.5) * cur + h * Poly::loss(a) + 0.5 * (std::abs(cur) - h * a);
+    }
+    return rst;
+  }
+  #pragma omp simd reduction(+:rst)
+  for (int i = 0; i < n; i++) {
+    const double cur = res[i], u = clampUnit(h1 * cur), a = std::abs(u);
+    der[i] = 0.5 - tau - Poly::der(u);
+    rst += (tau - 0.5) * cur + h * Poly::loss(a) + 0.5 * (std::abs(cur) - h * a);
+  }
+  return rst;
+}
+
+CONQUER_TARGET_CLONES
+void unifDer(const double* res, double* der, const int n, const double tau, const double h1) {
+  compactDer<UnifPoly>(res, der, n, tau, h1);
+}
+
+CONQUER_TARGET_CLONES
+void paraDer(const double* res, double* der, const int n, const double tau, const double h1) {
+  compactDer<ParaPoly>(res, der, n, tau, h1);
+}
+
+CONQUER_TARGET_CLONES
+void trianDer(const double* res, double* der, const int n, const double tau, const double h1) {
+  compactDer<TrianPoly>(res, der, n, tau, h1);
+}
+
+CONQUER_TARGET_CLONES
+double unifLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1) {
+  return compactLoss<UnifPoly>(res, der, n, tau, h, h1);
+}
+
+CONQUER_TARGET_CLONES
+double paraLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1) {
+  return compactLoss<ParaPoly>(res, der, n, tau, h, h1);
+}
+
+CONQUER_TARGET_CLONES
+double trianLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1) {
+  return compactLoss<TrianPoly>(res, der, n, tau, h, h1);
+}
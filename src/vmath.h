@@ -0,0 +1,221 @@
+#ifndef VMATH_H
+#define VMATH_H
+
+# include <cmath>
+# include <cstdint>
+# include <cstring>
+# include <algorithm>
+
+// Branch-free double precision exp, erfc, normal cdf / pdf, logistic and softplus, and the smoothing kernels built on them. The scalar versions below are written so that a loop
+// calling them vectorizes under "omp simd"; the array versions in vmath.cpp are compiled for several instruction sets and the best one is
+// picked at load time. Maximum error against long double references, measured on 4e6 uniform draws per range:
+//   vexp       1.2 ulp on [-708, 709]
+//   verfc      4.1 ulp on [-6, 6], relative error below 1e-15 on [6, 26.5], and 0 beyond where erfc is subnormal
+//   vnormcdf   same as 0.5 * erfc(-x / sqrt(2)) through libm: 85 ulp on [-8, 8] and 2e-13 relative on [-37, -8], all from rounding x / sqrt(2)
+//   vnormpdf   2.3 ulp on [-37, 37]
+//   vlogistic  2.1 ulp on [-700, 700]
+//   vsoftplus  3.2 ulp on [-700, 700]
+// Arguments beyond the range of double are clamped, so vexp(x) for x < -708 returns exp(-708) instead of a subnormal.
+
+// With GCC on x86-64 Linux the array kernels are compiled for AVX-512, AVX2 and baseline x86-64, and dispatched on CPU features at load time
+// through an ifunc resolver. Other targets use the polynomial kernels only where doubles and 64-bit integers share vector registers (AVX2,
+// NEON on arm64), and libm otherwise, where the scalar polynomial kernels would be slower than libm. The baseline clone is only picked on
+// x86-64 CPUs without AVX2.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+# define CONQUER_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+# define CONQUER_VMATH
+#else
+# define CONQUER_TARGET_CLONES
+# if defined(__AVX2__) || defined(__aarch64__)
+#  define CONQUER_VMATH
+# endif
+#endif
+
+// The scalar kernels must be inlined into the caller's simd loop to vectorize
+#if defined(__GNUC__)
+# define CONQUER_INLINE inline __attribute__((always_inline))
+#else
+# define CONQUER_INLINE inline
+#endif
+
+CONQUER_INLINE uint64_t asBits(const double x) {
+  uint64_t u;
+  std::memcpy(&u, &x, sizeof(double));
+  return u;
+}
+
+CONQUER_INLINE double asDouble(const uint64_t u) {
+  double x;
+  std::memcpy(&x, &u, sizeof(double));
+  return x;
+}
+
+// cond ? a : b through a bit mask. A ternary or std::min on doubles stays a branch unless -ffinite-math-only, which blocks vectorization.
+CONQUER_INLINE double blend(const bool cond, const double a, const double b) {
+  const uint64_t mask = -(uint64_t)cond;
+  return asDouble((asBits(a) & mask) | (asBits(b) & ~mask));
+}
+
+// exp(x + xlo), where xlo is a small correction carried in extended precision. k = round(x / log 2) is read off the mantissa of x / log 2 +
+// 1.5 * 2^52, the reduced argument |r| <= log(2) / 2 is split with a two-part log 2 (Cody-Waite) and exp(r) is the degree 13 Taylor polynomial.
+CONQUER_INLINE double vexp(double x, const double xlo = 0.0) {
+#ifndef CONQUER_VMATH
+  return std::exp(x + xlo);
+#else
+  x = blend(x < -708.0, -708.0, x);
+  x = blend(x > 709.0, 709.0, x);
+  const double kd = (x + xlo) * 1.4426950408889634 + 6755399441055744.0;
+  const double k = kd - 6755399441055744.0;
+  const double r = (x - k * 6.93147180369123816490e-01) + (xlo - k * 1.90821492927058770002e-10);
+  double p = 1.6059043836821614599e-10;
+  p = p * r + 2.0876756987868098979e-09;
+  p = p * r + 2.5052108385441718775e-08;
+  p = p * r + 2.7557319223985890653e-07;
+  p = p * r + 2.7557319223985890653e-06;
+  p = p * r + 2.4801587301587301587e-05;
+  p = p * r + 1.9841269841269841270e-04;
+  p = p * r + 1.3888888888888888889e-03;
+  p = p * r + 8.3333333333333333333e-03;
+  p = p * r + 4.1666666666666666667e-02;
+  p = p * r + 1.6666666666666666667e-01;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+  return asDouble(asBits(p) + (asBits(kd) << 52));
+#endif
+}
+
+// erfc(z) = t * exp(-z^2 + f(2t - 1)) with t = 2 / (2 + |z|), where f is a degree 27 polynomial, converted from a Chebyshev fit of
+// log(erfc(z) / t) + z^2 on z >= 0, and evaluated as four interleaved Horner chains in y^4 to keep the dependency chain short. z^2 is split
+// into an exact head and a tail (Dekker) so that exp sees the full argument. Negative z use erfc(z) = 2 - erfc(-z).
+CONQUER_INLINE double verfc(const double z) {
+#ifndef CONQUER_VMATH
+  return std::erfc(z);
+#else
+  static constexpr double coef[28] = {
+    -0.6717940840566923, 0.6726432239776567, 0.04734330684190443, -0.0468956102311753, -0.009872689366389959, 0.008824938557060623,
+    0.001758933557799016, -0.002345812500482853, -0.00014624686337800336, 0.000673678795580235, -9.37350311709817e-05, -0.0001743029472030762,
+    7.14010141275703e-05, 3.17451797494374e-05, -3.0187884551394243e-05, 1.3772664134464417e-07, 8.562623420121286e-06, -2.947986876998259e-06,
+    -1.27231190486887e-06, 1.2500276612569754e-06, -1.6849800720653297e-07, -2.495832761719667e-07, 1.5334345920908177e-07, 1.4448658046252676e-09,
+    -3.9171820510271855e-08, 1.1172352263623759e-08, 4.06088214696972e-09, -1.8902306008944537e-09};
+  const double a = blend(std::abs(z) < 26.5, std::abs(z), 26.5);
+  const double t = 2.0 / (2.0 + a);
+  const double y = 2.0 * t - 1.0, y2 = y * y, y4 = y2 * y2;
+  double p0 = coef[24], p1 = coef[25], p2 = coef[26], p3 = coef[27];
+  #pragma GCC unroll 6
+  for (int k = 20; k >= 0; k -= 4) {
+    p0 = p0 * y4 + coef[k];
+    p1 = p1 * y4 + coef[k + 1];
+    p2 = p2 * y4 + coef[k + 2];
+    p3 = p3 * y4 + coef[k + 3];
+  }
+  const double f = (p0 + p1 * y) + (p2 + p3 * y) * y2;
+  const double c = a * 134217729.0;
+  const double ah = c - (c - a), al = a - ah;
+  const double e = t * vexp(-ah * ah, f - (2.0 * ah + al) * al);
+  return blend(z < 0, 2.0 - e, blend(a < 26.5, e, 0.0));
+#endif
+}
+
+CONQUER_INLINE double vnormcdf(const double x) {
+  return 0.5 * verfc(-0.70710678118654752 * x);
+}
+
+CONQUER_INLINE double vnormpdf(const double x) {
+#ifndef CONQUER_VMATH
+  return 0.39894228040143268 * std::exp(-0.5 * x * x);
+#else
+  const double c = x * 134217729.0;
+  const double xh = c - (c - x), xl = x - xh;
+  return 0.39894228040143268 * vexp(-0.5 * xh * xh, -0.5 * (2.0 * xh + xl) * xl);
+#endif
+}
+
+// log(1 + u) for u in [0, 1] as 2 * atanh(u / (2 + u)), an odd series in s = u / (2 + u) <= 1 / 3
+CONQUER_INLINE double log1pUnit(const double u) {
+#ifndef CONQUER_VMATH
+  return std::log1p(u);
+#else
+  const double s = u / (2.0 + u), s2 = s * s;
+  double p = 1.0 / 35;
+  #pragma GCC unroll 17
+  for (int k = 33; k > 0; k -= 2) {
+    p = p * s2 + 1.0 / k;
+  }
+  return 2.0 * s * p;
+#endif
+}
+
+// 1 / (1 + exp(x))
+CONQUER_INLINE double vlogistic(const double x) {
+  const double e = vexp(-std::abs(x));
+  return blend(x > 0, e, 1.0) / (1.0 + e);
+}
+
+// log(1 + exp(x)) without overflow
+CONQUER_INLINE double vsoftplus(const double x) {
+  return blend(x > 0, x, 0.0) + log1pUnit(vexp(-std::abs(x)));
+}
+
+// The compact kernels are polynomials in u = res / h clamped to [-1, 1]: der = 0.5 - tau - D(u) and the loss is
+// (tau - 0.5) * res + h * G(|u|) + 0.5 * (|res| - h * |u|), with G(1) = 0.5 so that both pieces agree at |res| = h. Clamping replaces the
+// branches on res <= -h, |res| < h and res >= h, so the loops vectorize and do not mispredict when residuals sit near +-h.
+CONQUER_INLINE double clampUnit(const double x) {
+  return blend(x < -1.0, -1.0, blend(x > 1.0, 1.0, x));
+}
+
+struct UnifPoly {
+  static double der(const double u) {
+    return 0.5 * u;
+  }
+  static double loss(const double a) {
+    return 0.25 * a * a + 0.25;
+  }
+};
+
+struct ParaPoly {
+  static double der(const double u) {
+    return 0.75 * u - 0.25 * u * u * u;
+  }
+  static double loss(const double a) {
+    const double a2 = a * a;
+    return 0.375 * a2 - 0.0625 * a2 * a2 + 0.1875;
+  }
+};
+
+struct TrianPoly {
+  static double der(const double u) {
+    return u - 0.5 * u * std::abs(u);
+  }
+  static double loss(const double a) {
+    return 0.5 * a * a - 0.1666667 * a * a * a + 0.1666667;
+  }
+};
+
+// der[i] = Phi(-h1 * res[i]) - tau
+void gaussDer(const double* res, double* der, const int n, const double tau, const double h1);
+
+// der[i] = 1 / (1 + exp(h1 * res[i])) - tau
+void logisticDer(const double* res, double* der, const int n, const double tau, const double h1);
+
+// Sum over i of the Gaussian-smoothed check loss at res[i]; the derivative is written to der at the same time unless der is null
+double gaussLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1, const double h2);
+
+// Sum over i of the logistic-smoothed check loss at res[i]; the derivative is written to der at the same time unless der is null
+double logisticLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1);
+
+// der[i] = 0.5 - tau - D(res[i] / h) for the uniform, parabolic and triangular kernels
+void unifDer(const double* res, double* der, const int n, const double tau, const double h1);
+
+void paraDer(const double* res, double* der, const int n, const double tau, const double h1);
+
+void trianDer(const double* res, double* der, const int n, const double tau, const double h1);
+
+// Sums of the compact-kernel smoothed check losses, with the derivative written to der at the same time unless der is null
+double unifLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1);
+
+double paraLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1);
+
+double trianLoss(const double* res, double* der, const int n, const double tau, const double h, const double h1);
+
+#endif